@@ -0,0 +1,144 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the implementation for the AccessPattern object.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Implementation: AccessPattern
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+
+#include "AccessPattern.h"
+#include "param_funcs.h"
+
+AccessPattern::AccessPattern() : kind(MemLine), parameter(0), lineSize(32), page(0), pageFree(0)
+{
+}
+
+/**
+ * @ingroup AccessPattern
+ * @brief   Reads line, stride:N, stream, interleave:K or randomPage
+ *
+ * @param spec
+ * @param kindOut
+ * @param parameterOut Stride in bytes or number of streams, 0 otherwise
+ * @return 0 if spec is not a pattern or its parameter is out of range
+ */
+BOOL AccessPattern::parse(const std::string &spec, InstSubType &kindOut, UINT_32 &parameterOut)
+{
+   /* Variables */
+   std::string::size_type colon = spec.find(':');
+   std::string name = spec.substr(0, colon);
+   INT_32 value = colon == std::string::npos ? 0 : atoi(spec.c_str() + colon + 1);
+
+   /* Processes */
+   parameterOut = 0;
+
+   if(name == "line" && colon == std::string::npos)
+      kindOut = MemLine;
+   else if(name == "stream" && colon == std::string::npos)
+      kindOut = MemStream;
+   else if(name == "randomPage" && colon == std::string::npos)
+      kindOut = MemRandomPage;
+   else if(name == "stride" && value > 0 && value <= _15_BIT_RANGE && value % sizeof(INT_32) == 0)
+   {
+      kindOut = MemStride;
+      parameterOut = value;
+   }
+   else if(name == "interleave" && value >= 2 && value <= PATTERN_MAX_STREAMS)
+   {
+      kindOut = MemInterleave;
+      parameterOut = value;
+   }
+   else
+      return 0;
+
+   return 1;
+}
+
+void AccessPattern::set(InstSubType kindIn, UINT_32 parameterIn, UINT_32 lineSizeIn)
+{
+   kind = kindIn;
+   parameter = parameterIn;
+   lineSize = lineSizeIn;
+
+   page = pageFree = 0;
+   pageUsed.clear();
+}
+
+/**
+ * @ingroup AccessPattern
+ * @brief   Offset that follows offset in this pattern
+ *
+ * Body restarts a stream by setting its base back to 0, so an offset of 0 also restarts
+ * the randomPage bookkeeping. Running past the 16-bit window is left to the caller.
+ *
+ * @param offset Last offset handed out
+ * @return Next offset, always a multiple of the word size
+ */
+UINT_32 AccessPattern::next(UINT_32 offset)
+{
+   /* Variables */
+   UINT_32 const linesPerPage = lineSize < PATTERN_PAGE ? PATTERN_PAGE / lineSize : 1;
+
+   /* Processes */
+   if(kind == MemStride)
+      return offset + parameter;
+   else if(kind == MemStream)
+      return offset + sizeof(INT_32);
+   else if(kind == MemInterleave)
+   {
+      //stream s owns [s * span, (s + 1) * span) and walks it one line at a time
+      UINT_32 span = (_15_BIT_RANGE + 1) / parameter / lineSize * lineSize;
+      if(span < lineSize)
+         span = lineSize;
+
+      UINT_32 stream = offset / span;
+      UINT_32 position = offset % span;
+
+      if(stream + 1 < parameter)
+         return (stream + 1) * span + position;
+      else
+         return position + lineSize;
+   }
+   else if(kind == MemRandomPage)
+   {
+      if(offset == 0 || pageUsed.size() != linesPerPage)
+      {
+         page = offset / PATTERN_PAGE;
+         pageUsed.assign(linesPerPage, 0);
+         pageUsed[(offset % PATTERN_PAGE) / lineSize % linesPerPage] = 1;
+         pageFree = linesPerPage - 1;
+      }
+
+      if(pageFree == 0)
+      {
+         page = page + 1;
+         pageUsed.assign(linesPerPage, 0);
+         pageFree = linesPerPage;
+      }
+
+      //pick the n-th line of the page that has not been handed out
+      UINT_32 pick = uniformIntRV(0, pageFree - 1);
+      UINT_32 line = 0;
+      for(line = 0; line < linesPerPage; line++)
+      {
+         if(pageUsed[line] == 0 && pick-- == 0)
+            break;
+      }
+
+      pageUsed[line] = 1;
+      pageFree = pageFree - 1;
+
+      return page * PATTERN_PAGE + line * lineSize;
+   }
+
+   return offset + lineSize;
+}
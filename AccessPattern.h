@@ -0,0 +1,64 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the interface for the AccessPattern object.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Interface: AccessPattern
+ * Decides where the next unique offset of a memory stream lands. Body keeps one pattern
+ * for each of the shared/private load/store streams and asks it for the offset after the
+ * last one handed out:
+ *    line        -- one cache line further (the original behavior)
+ *    stride:N    -- N bytes further
+ *    stream      -- the next word, so every word of a line is used before the next line
+ *    interleave:K -- K line-sequential streams spread over the window, visited round robin
+ *    randomPage  -- an unused line of the current page chosen at random, then the next page
+ * The first three are prefetcher friendly; interleave stresses the number of streams a
+ * prefetcher tracks and randomPage defeats it while keeping TLB reach the same.
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ACCESS_PATTERN_H
+#define ACCESS_PATTERN_H
+
+#include <string>
+#include <vector>
+
+#include "param_types.h"
+
+#define PATTERN_PAGE 4096                 //page size assumed by randomPage
+#define PATTERN_MAX_STREAMS 64            //most streams interleave may spread over
+
+/**
+ * @ingroup AccessPattern
+ * @brief   Offset sequence of one memory stream
+ *
+ */
+class AccessPattern
+{
+   public:
+      /* Constructor */
+      AccessPattern();
+
+      static BOOL          parse(const std::string &spec, InstSubType &kindOut, UINT_32 &parameterOut);
+
+      /* Functions */
+      void                 set(InstSubType kindIn, UINT_32 parameterIn, UINT_32 lineSizeIn);
+      UINT_32              next(UINT_32 offset);
+
+   private:
+      InstSubType          kind;
+      UINT_32              parameter;                             //stride bytes or stream count
+      UINT_32              lineSize;
+
+      UINT_32              page;                                  //randomPage: page being filled
+      UINT_32              pageFree;                              //randomPage: lines of it not handed out
+      std::vector< BOOL >  pageUsed;
+};
+
+#endif
@@ -0,0 +1,474 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the implementation for the AsmPacker object.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Implementation: AsmPacker
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cctype>
+#include <cstdlib>
+
+#include "AsmPacker.h"
+
+/**
+ * @ingroup AsmPacker
+ *
+ * @param maxInstructionsIn Most instructions one merged statement may hold
+ */
+AsmPacker::AsmPacker(UINT_32 maxInstructionsIn) : maxInstructions(maxInstructionsIn), statementsIn(0), statementsOut(0)
+{
+   if(maxInstructions < 1)
+      maxInstructions = 1;
+}
+
+/**
+ * @ingroup AsmPacker
+ * @brief   Packs a file in place
+ *
+ * @param fileName File to rewrite
+ * @return Bytes in the packed file
+ */
+UINT_64 AsmPacker::packFile(const std::string &fileName)
+{
+   /* Variables */
+   std::ostringstream packed;
+
+   /* Processes */
+   {
+      std::ifstream inputFile(fileName.c_str());
+      if(!inputFile)
+      {
+         std::cerr << "Error opening file " << fileName << " for packing." << std::endl;
+         exit(1);
+      }
+
+      pack(inputFile, packed);
+   }
+
+   std::ofstream outputFile(fileName.c_str(), std::ios::trunc);
+   if(!outputFile)
+   {
+      std::cerr << "Error opening file " << fileName << " for packing." << std::endl;
+      exit(1);
+   }
+   outputFile << packed.str();
+
+   return packed.str().size();
+}
+
+/**
+ * @ingroup AsmPacker
+ * @brief   Copies a program, merging runs of asm statements
+ *
+ * Lines that are not single-instruction asm statements are copied as they are and end
+ * the current run. A run of one statement is also copied as written.
+ *
+ * @param inputFile Program to read
+ * @param outputFile Where the packed program goes
+ */
+void AsmPacker::pack(std::istream &inputFile, std::ostream &outputFile)
+{
+   /* Variables */
+   std::string line;
+   Statement statement;
+
+   /* Processes */
+   run.clear();
+   while(std::getline(inputFile, line))
+   {
+      if(parse(line, statement))
+      {
+         statementsIn++;
+         if(!fits(statement))
+            flush(outputFile);
+         run.push_back(statement);
+      }
+      else
+      {
+         flush(outputFile);
+         outputFile << line << "\n";
+      }
+   }
+
+   flush(outputFile);
+}
+
+/**
+ * @ingroup AsmPacker
+ * @brief   Reads one asm statement
+ *
+ * Accepts __asm__ __volatile__ ( "template" : outputs : inputs : clobbers ); on a line of
+ * its own, where the template is one instruction (no label, newline or branch) and every
+ * operand is a plain variable with an r, x or f constraint.
+ *
+ * @param line Line of the program
+ * @param statementOut The statement, when the line is one
+ * @return 1 if the line can be merged with its neighbours
+ */
+BOOL AsmPacker::parse(const std::string &line, Statement &statementOut)
+{
+   /* Variables */
+   std::string const keyword = "__asm__ __volatile__";
+   std::string::size_type start = line.find_first_not_of(" \t");
+   std::string::size_type end = line.find_last_not_of(" \t\r");
+   std::vector< std::string > sections;
+
+   /* Processes */
+   if(start == std::string::npos || line.compare(start, keyword.size(), keyword) != 0)
+      return 0;
+   if(end < start + keyword.size() + 2 || line[end] != ';' || line[end - 1] != ')')
+      return 0;
+
+   std::string body = trim(line.substr(start + keyword.size(), end - 1 - start - keyword.size()));
+   if(body.size() < 3 || body[0] != '(')
+      return 0;
+   body = trim(body.substr(1));
+   if(body.empty() || body[0] != '"')
+      return 0;
+
+   //the template: one quoted string with no escapes, labels or branches
+   std::string::size_type close = body.find('"', 1);
+   if(close == std::string::npos)
+      return 0;
+
+   statementOut.line = line;
+   statementOut.indent = line.substr(0, start);
+   statementOut.assembly = trim(body.substr(1, close - 1));
+   statementOut.outputs.clear();
+   statementOut.inputs.clear();
+   statementOut.clobbers.clear();
+
+   if(statementOut.assembly.empty() || statementOut.assembly.find_first_of(":\\;") != std::string::npos)
+      return 0;
+   if(statementOut.assembly[0] == 'b' || statementOut.assembly[0] == 'j' || statementOut.assembly[0] == '.')
+      return 0;
+
+   std::string rest = trim(body.substr(close + 1));
+   if(rest.empty())
+      return 1;
+   if(rest[0] != ':')
+      return 0;
+
+   sections = split(rest.substr(1), ':');
+   if(sections.size() > 3)
+      return 0;
+
+   for(UINT_32 section = 0; section < sections.size(); section++)
+   {
+      std::vector< std::string > items = split(sections[section], ',');
+
+      for(UINT_32 item = 0; item < items.size(); item++)
+      {
+         std::string text = trim(items[item]);
+         Operand operand;
+
+         if(text.empty())
+         {
+            if(items.size() > 1)
+               return 0;
+            continue;
+         }
+
+         if(section == 2)
+         {
+            statementOut.clobbers.push_back(text);
+            continue;
+         }
+
+         if(!parseOperand(text, operand))
+            return 0;
+
+         if(section == 0)
+         {
+            if(operand.constraint[0] != '=' && operand.constraint[0] != '+')
+               return 0;
+            statementOut.outputs.push_back(operand);
+         }
+         else
+         {
+            if(operand.constraint.size() != 1)
+               return 0;
+            statementOut.inputs.push_back(operand);
+         }
+      }
+   }
+
+   return 1;
+}
+
+/**
+ * @ingroup AsmPacker
+ * @brief   Splits on a separator outside quotes and parentheses
+ */
+std::vector< std::string > AsmPacker::split(const std::string &text, char separator)
+{
+   /* Variables */
+   std::vector< std::string > pieces;
+   std::string piece;
+   INT_32 depth = 0;
+   BOOL quoted = 0;
+
+   /* Processes */
+   for(UINT_32 position = 0; position < text.size(); position++)
+   {
+      char c = text[position];
+
+      if(c == '"')
+         quoted = !quoted;
+      else if(!quoted && c == '(')
+         depth++;
+      else if(!quoted && c == ')')
+         depth--;
+
+      if(c == separator && !quoted && depth == 0)
+      {
+         pieces.push_back(piece);
+         piece.clear();
+      }
+      else
+         piece += c;
+   }
+   pieces.push_back(piece);
+
+   return pieces;
+}
+
+/**
+ * @ingroup AsmPacker
+ * @brief   Reads "c"(variable), where c is r, x or f with an optional = or +
+ */
+BOOL AsmPacker::parseOperand(const std::string &text, Operand &operandOut)
+{
+   /* Variables */
+   std::string::size_type close = text.find('"', 1);
+
+   /* Processes */
+   if(text.size() < 6 || text[0] != '"' || close == std::string::npos)
+      return 0;
+
+   operandOut.constraint = text.substr(1, close - 1);
+   std::string variable = trim(text.substr(close + 1));
+
+   if(variable.size() < 3 || variable[0] != '(' || variable[variable.size() - 1] != ')')
+      return 0;
+   operandOut.variable = trim(variable.substr(1, variable.size() - 2));
+
+   if(operandOut.variable.empty() || isdigit(operandOut.variable[0]))
+      return 0;
+   for(UINT_32 position = 0; position < operandOut.variable.size(); position++)
+   {
+      if(!isalnum(operandOut.variable[position]) && operandOut.variable[position] != '_')
+         return 0;
+   }
+
+   std::string letter = operandOut.constraint;
+   if(!letter.empty() && (letter[0] == '=' || letter[0] == '+'))
+      letter = letter.substr(1);
+
+   return letter == "r" || letter == "x" || letter == "f";
+}
+
+/**
+ * @ingroup AsmPacker
+ * @brief   Strips leading and trailing blanks
+ */
+std::string AsmPacker::trim(const std::string &text)
+{
+   std::string::size_type start = text.find_first_not_of(" \t");
+   if(start == std::string::npos)
+      return "";
+
+   return text.substr(start, text.find_last_not_of(" \t") - start + 1);
+}
+
+/**
+ * @ingroup AsmPacker
+ * @brief   Lists the variables of a group of statements
+ *
+ * @param statements Statements to be merged
+ * @param variables Every variable, in order of first use
+ * @param classes Register class (r, x or f) of each variable
+ * @param written Variables some statement writes
+ * @return 0 if a variable is used with two register classes
+ */
+BOOL AsmPacker::collect(const std::vector< Statement > &statements, std::vector< std::string > &variables,
+                        std::map< std::string, char > &classes, std::set< std::string > &written)
+{
+   /* Processes */
+   for(UINT_32 statement = 0; statement < statements.size(); statement++)
+   {
+      for(UINT_32 operand = 0; operand < statements[statement].outputs.size() + statements[statement].inputs.size(); operand++)
+      {
+         BOOL isOutput = operand < statements[statement].outputs.size();
+         const Operand &current = isOutput ? statements[statement].outputs[operand]
+                                           : statements[statement].inputs[operand - statements[statement].outputs.size()];
+         char letter = current.constraint[current.constraint.size() - 1];
+
+         std::map< std::string, char >::iterator class_it = classes.find(current.variable);
+         if(class_it == classes.end())
+         {
+            classes[current.variable] = letter;
+            variables.push_back(current.variable);
+         }
+         else if(class_it->second != letter)
+            return 0;
+
+         if(isOutput)
+            written.insert(current.variable);
+      }
+   }
+
+   return 1;
+}
+
+/**
+ * @ingroup AsmPacker
+ * @brief   Whether a statement can join the current run
+ *
+ * The merged statement must stay within the instruction limit, the operand limit, and
+ * PACKER_MAX_REGISTERS variables of each register class so that gcc can allocate it.
+ */
+BOOL AsmPacker::fits(const Statement &statementIn) const
+{
+   /* Variables */
+   std::vector< Statement > group(run);
+   std::vector< std::string > variables;
+   std::map< std::string, char > classes;
+   std::set< std::string > written;
+   std::map< char, UINT_32 > perClass;
+
+   /* Processes */
+   if(run.empty() || run.size() >= maxInstructions)
+      return 0;
+
+   group.push_back(statementIn);
+   if(!collect(group, variables, classes, written))
+      return 0;
+   if(variables.size() > PACKER_MAX_OPERANDS)
+      return 0;
+
+   for(std::map< std::string, char >::iterator class_it = classes.begin(); class_it != classes.end(); class_it++)
+   {
+      if(++perClass[class_it->second] > PACKER_MAX_REGISTERS)
+         return 0;
+   }
+
+   return 1;
+}
+
+/**
+ * @ingroup AsmPacker
+ * @brief   Writes the current run as one statement
+ *
+ * Written variables come first as "+&c" operands, read-only ones follow as inputs, and
+ * each template's operand numbers are rewritten to the merged numbering.
+ */
+void AsmPacker::flush(std::ostream &outputFile)
+{
+   /* Variables */
+   std::vector< std::string > variables;
+   std::map< std::string, char > classes;
+   std::set< std::string > written;
+   std::vector< std::string > order;
+   std::map< std::string, UINT_32 > number;
+   std::set< std::string > clobbers;
+   std::string assembly;
+
+   /* Processes */
+   if(run.empty())
+      return;
+
+   statementsOut++;
+   if(run.size() == 1)
+   {
+      outputFile << run[0].line << "\n";
+      run.clear();
+      return;
+   }
+
+   collect(run, variables, classes, written);
+   for(UINT_32 variable = 0; variable < variables.size(); variable++)
+   {
+      if(written.count(variables[variable]))
+         order.push_back(variables[variable]);
+   }
+   UINT_32 outputCount = order.size();
+   for(UINT_32 variable = 0; variable < variables.size(); variable++)
+   {
+      if(!written.count(variables[variable]))
+         order.push_back(variables[variable]);
+   }
+   for(UINT_32 variable = 0; variable < order.size(); variable++)
+      number[order[variable]] = variable;
+
+   for(UINT_32 statement = 0; statement < run.size(); statement++)
+   {
+      const std::string &text = run[statement].assembly;
+
+      if(statement > 0)
+         assembly += "\\n\\t";
+
+      for(UINT_32 position = 0; position < text.size(); position++)
+      {
+         if(text[position] != '%')
+         {
+            assembly += text[position];
+            continue;
+         }
+
+         //%% is a literal register prefix; otherwise %[modifier]N names an operand
+         std::string::size_type digits = position + 1;
+         while(digits < text.size() && isalpha(text[digits]))
+            digits++;
+         if(digits >= text.size() || !isdigit(text[digits]) || text[position + 1] == '%')
+         {
+            assembly += text[position];
+            if(position + 1 < text.size() && text[position + 1] == '%')
+               assembly += text[++position];
+            continue;
+         }
+
+         std::string::size_type last = digits;
+         while(last < text.size() && isdigit(text[last]))
+            last++;
+
+         UINT_32 operand = atoi(text.substr(digits, last - digits).c_str());
+         const Operand &current = operand < run[statement].outputs.size() ? run[statement].outputs[operand]
+                                                                          : run[statement].inputs[operand - run[statement].outputs.size()];
+
+         std::ostringstream renumbered;
+         renumbered << text.substr(position, digits - position) << number[current.variable];
+         assembly += renumbered.str();
+         position = last - 1;
+      }
+
+      clobbers.insert(run[statement].clobbers.begin(), run[statement].clobbers.end());
+   }
+
+   outputFile << run[0].indent << "__asm__ __volatile__ ( \"" << assembly << "\"\t :";
+   for(UINT_32 variable = 0; variable < outputCount; variable++)
+      outputFile << (variable ? ", " : " ") << "\"+&" << classes[order[variable]] << "\"(" << order[variable] << ")";
+   outputFile << " :";
+   for(UINT_32 variable = outputCount; variable < order.size(); variable++)
+      outputFile << (variable > outputCount ? ", " : " ") << "\"" << classes[order[variable]] << "\"(" << order[variable] << ")";
+   if(!clobbers.empty())
+   {
+      outputFile << " :";
+      for(std::set< std::string >::iterator clobber_it = clobbers.begin(); clobber_it != clobbers.end(); clobber_it++)
+         outputFile << (clobber_it == clobbers.begin() ? " " : ", ") << *clobber_it;
+   }
+   outputFile << " );\n";
+
+   run.clear();
+}
@@ -0,0 +1,91 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the interface for the AsmPacker object.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Interface: AsmPacker
+ * Shrinks a written program by merging runs of one-instruction asm statements into
+ * statements of up to N instructions. The instruction stream is unchanged; only the
+ * number of statements the compiler has to parse and allocate registers for drops.
+ * A statement joins a run only when its operands are plain variables with an r, x or f
+ * constraint and its template holds one instruction with no label or branch. Every
+ * variable written anywhere in a merged statement becomes one early-clobbered in/out
+ * operand, so it keeps a single register for the whole statement.
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ASM_PACKER_H
+#define ASM_PACKER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <istream>
+#include <ostream>
+
+#include "param_types.h"
+
+#define PACKER_MAX_OPERANDS 30            //gcc accepts at most 30 asm operands
+#define PACKER_MAX_REGISTERS 10           //most variables of one register class per statement
+
+/**
+ * @ingroup AsmPacker
+ * @brief   Merges runs of inline-assembly statements
+ *
+ */
+class AsmPacker
+{
+   public:
+      /* Constructor */
+      AsmPacker(UINT_32 maxInstructionsIn);
+
+      /* Functions */
+      UINT_64              packFile(const std::string &fileName);
+      void                 pack(std::istream &inputFile, std::ostream &outputFile);
+
+      UINT_64              get_statementsIn(void) const { return statementsIn; }
+      UINT_64              get_statementsOut(void) const { return statementsOut; }
+
+   private:
+      struct Operand
+      {
+         std::string       constraint;                            //"=r", "+x", "r", ...
+         std::string       variable;
+      };
+
+      struct Statement
+      {
+         std::string       line;                                  //as written
+         std::string       indent;
+         std::string       assembly;                              //template, without quotes
+         std::vector< Operand > outputs;
+         std::vector< Operand > inputs;
+         std::vector< std::string > clobbers;                     //with quotes
+      };
+
+      UINT_32              maxInstructions;
+      UINT_64              statementsIn;
+      UINT_64              statementsOut;
+
+      std::vector< Statement > run;
+
+      static BOOL          parse(const std::string &line, Statement &statementOut);
+      static std::vector< std::string > split(const std::string &text, char separator);
+      static BOOL          parseOperand(const std::string &text, Operand &operandOut);
+      static std::string   trim(const std::string &text);
+
+      static BOOL          collect(const std::vector< Statement > &statements, std::vector< std::string > &variables,
+                                   std::map< std::string, char > &classes, std::set< std::string > &written);
+
+      BOOL                 fits(const Statement &statementIn) const;
+      void                 flush(std::ostream &outputFile);
+};
+
+#endif
@@ -63,37 +63,37 @@ Skeleton AssimilateSkeleton::loadSkeleton()
 
       if((tokenizedLine[0] == "<cell>"))
       {
-        Cell *tempCell = new Cell;
+        Cell tempCell;
+        SkeletonStore *store = skel.get_store ( );
 
         switch ( atoi(tokenizedLine[2].c_str( ) ) )
         {
-          case 0: tempCell->setCellType( Sequential ); break;
-          case 1: tempCell->setCellType( Transactional ); break;
+          case 0: tempCell.setCellType( Sequential ); break;
+          case 1: tempCell.setCellType( Transactional ); break;
           default: cout << "\nFatal Error: Unknown Cell Type" << endl; break;
         }
 
-        tempCell->setNumInstructions( strtoull(tokenizedLine[3].c_str(),NULL,10) );
-        tempCell->setNumUniqueReads( strtoull(tokenizedLine[4].c_str(),NULL,10) );
-        tempCell->setNumUniqueWrites( strtoull(tokenizedLine[5].c_str(),NULL,10) );
-        tempCell->setNumSharedReads( strtoull(tokenizedLine[6].c_str(),NULL,10) );
-        tempCell->setNumSharedWrites( strtoull(tokenizedLine[7].c_str(),NULL,10) );
-        tempCell->setNumMemoryOps( strtoull(tokenizedLine[8].c_str(),NULL,10) );
-        tempCell->setNumIntegerOps( strtoull(tokenizedLine[9].c_str(),NULL,10) );
-        tempCell->setNumFloatingPointOps( strtoull(tokenizedLine[10].c_str(),NULL,10) );
+        tempCell.setNumInstructions( strtoull(tokenizedLine[3].c_str(),NULL,10) );
+        tempCell.setNumUniqueReads( strtoull(tokenizedLine[4].c_str(),NULL,10) );
+        tempCell.setNumUniqueWrites( strtoull(tokenizedLine[5].c_str(),NULL,10) );
+        tempCell.setNumSharedReads( strtoull(tokenizedLine[6].c_str(),NULL,10) );
+        tempCell.setNumSharedWrites( strtoull(tokenizedLine[7].c_str(),NULL,10) );
+        tempCell.setNumMemoryOps( strtoull(tokenizedLine[8].c_str(),NULL,10) );
+        tempCell.setNumIntegerOps( strtoull(tokenizedLine[9].c_str(),NULL,10) );
+        tempCell.setNumFloatingPointOps( strtoull(tokenizedLine[10].c_str(),NULL,10) );
 
         switch ( atoi(tokenizedLine[11].c_str( ) ) )
         {
-          case 0: tempCell->setConflictModel( Random ); break;
-          case 1: tempCell->setConflictModel( High ); break;
-          case 2: tempCell->setConflictModel( Specified ); break;
+          case 0: tempCell.setConflictModel( Random ); break;
+          case 1: tempCell.setConflictModel( High ); break;
+          case 2: tempCell.setConflictModel( Specified ); break;
           default: cout << "\nFatal Error: Unknown Conflict Model" << endl; break;
         }
 
         if ( tokenizedLine.size() > 12 )
         {
-
-           std::list< CONFLICT_PAIR > *loadConflictList = new list<CONFLICT_PAIR>;
-           std::list< CONFLICT_PAIR > *storeConflictList =  new list<CONFLICT_PAIR>;
+          // conflict pairs are appended to the store's flat array; the cell keeps offset ranges
+          unsigned int loadOffset, storeOffset;
 
           Tokenize ( tokenizedLine[12], tokenizedReadSet, "{}" );
           Tokenize ( tokenizedLine[13], tokenizedWriteSet , "{}" );
@@ -101,6 +101,7 @@ Skeleton AssimilateSkeleton::loadSkeleton()
           vector<string>::iterator it;
           vector<string> tmp;
 
+          loadOffset = store->getNumConflicts ( );
           for ( it = tokenizedReadSet.begin() ; it < tokenizedReadSet.end() ; it++ )
           {
             tmp.clear();
@@ -108,11 +109,13 @@ Skeleton AssimilateSkeleton::loadSkeleton()
 
             if ( tmp.size() > 1 )
             {
-              loadConflictList->push_back( pair < ADDRESS_INT, UINT_32 > ( strtoull(tmp[0].c_str(),NULL,16) , strtoull(tmp[1].c_str(),NULL,10) )  );
+              store->pushConflict( pair < ADDRESS_INT, UINT_32 > ( strtoull(tmp[0].c_str(),NULL,16) , strtoull(tmp[1].c_str(),NULL,10) )  );
             }
 
           }
+          tempCell.set_loadConflicts ( store->getConflictRange ( loadOffset, store->getNumConflicts ( ) - loadOffset ) );
 
+          storeOffset = store->getNumConflicts ( );
           for ( it = tokenizedWriteSet.begin() ; it < tokenizedWriteSet.end() ; it++ )
           {
             tmp.clear();
@@ -121,23 +124,26 @@ Skeleton AssimilateSkeleton::loadSkeleton()
 
             if ( tmp.size() > 1 )
             {
-              storeConflictList->push_back( pair < ADDRESS_INT, UINT_32 > ( strtoull(tmp[0].c_str(),NULL,16) , strtoull(tmp[1].c_str(),NULL,10) )  );
+              store->pushConflict( pair < ADDRESS_INT, UINT_32 > ( strtoull(tmp[0].c_str(),NULL,16) , strtoull(tmp[1].c_str(),NULL,10) )  );
             }
 
           }
-
-          tempCell->set_loadConflictList ( loadConflictList );
-          tempCell->set_storeConflictList ( storeConflictList );
+          tempCell.set_storeConflicts ( store->getConflictRange ( storeOffset, store->getNumConflicts ( ) - storeOffset ) );
 
         }
 
 
-        skel.getThread( atoi(tokenizedLine[1].c_str( ) ) )->push_back ( tempCell );
+        store->appendCell ( atoi(tokenizedLine[1].c_str( ) ), tempCell );
       }
 
     }
   }
 
+  // the cell arrays are complete, so the per-thread lists can point into them
+  for ( int x = 0; x < numThreads; x++ )
+  {
+    skel.linkThread ( x );
+  }
 
   return skel;
 
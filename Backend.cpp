@@ -0,0 +1,78 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the implementation for the code-generation backends.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Implementation: Backend
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <cstdlib>
+
+#include "Backend.h"
+#include "MipsBackend.h"
+#include "X86Backend.h"
+#include "CBackend.h"
+
+/**
+ * @ingroup Backend
+ * @brief   Builds the backend named in the descriptor
+ *
+ * @param name mips, x86_64 or c
+ * @return New backend; caller owns it
+ */
+Backend *Backend::create(const std::string &name)
+{
+   if(name == "mips")
+      return new MipsBackend();
+   else if(name == "x86_64" || name == "x86-64")
+      return new X86Backend();
+   else if(name == "c")
+      return new CBackend();
+
+   std::cerr << "Unknown backend \"" << name << "\" -- expected mips, x86_64 or c." << std::endl;
+   exit(1);
+}
+
+/**
+ * @ingroup Backend
+ * @brief   Strips the constraint from an operand -- r"(r_out_t0) becomes r_out_t0
+ */
+std::string Backend::variableName(const std::string &operand)
+{
+   std::string::size_type open = operand.find('(');
+   std::string::size_type close = operand.find(')', open);
+
+   if(open == std::string::npos || close == std::string::npos)
+      return operand;
+
+   return operand.substr(open + 1, close - open - 1);
+}
+
+/**
+ * @ingroup Backend
+ * @brief   Code run at the start of each program iteration; nothing unless a backend needs it
+ */
+void Backend::writeIterationSetup(std::ostream & /*outputFile*/)
+{
+}
+
+/**
+ * @ingroup Backend
+ * @brief   Declares chase_0 .. chase_(chains-1), which hold the current node of each pointer chain
+ *
+ * @param outputFile
+ * @param chains
+ */
+void Backend::writeChaseRegisters(std::ostream &outputFile, UINT_32 chains)
+{
+   for(UINT_32 chain = 0; chain < chains; chain++)
+      outputFile << "   " << get_addressType() << " chase_" << chain << ";\n";
+}
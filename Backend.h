@@ -0,0 +1,66 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the interface for the code-generation backends.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Interface: Backend
+ * Body decides what is written -- the instruction mix, memory offsets, loop shapes and
+ * transaction boundaries -- and a Backend decides how it is spelled for a target ISA.
+ * The backend is chosen with the Global->backend key (mips by default).
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BACKEND_H
+#define BACKEND_H
+
+#include <string>
+#include <ostream>
+
+#include "param_types.h"
+#include "Instruction.h"
+#include "OperandList.h"
+
+/**
+ * @ingroup Backend
+ * @brief   Target-specific writer used by Body
+ *
+ */
+class Backend
+{
+   public:
+      /* Constructor */
+      virtual ~Backend() {}
+
+      static Backend *     create(const std::string &name);
+
+      /* Functions */
+      virtual std::string  get_name(void) const = 0;
+      virtual std::string  get_addressType(void) const = 0;            //integer type that can hold a pointer
+      virtual BOOL         get_sharedBaseInRegister(void) const { return 0; }  //writeSharedBase pins a register rather than defining a variable
+
+      virtual std::string  intVariable(RegType registerIn) const = 0;
+      virtual std::string  fpVariable(RegType registerIn) const = 0;
+
+      virtual void         writeTransactionMacros(std::ostream &outputFile) = 0;
+      virtual void         writeSharedBase(std::ostream &outputFile) = 0;
+      virtual void         writeRegisters(std::ostream &outputFile) = 0;
+      virtual void         writeIterationSetup(std::ostream &outputFile);         //start of each program iteration
+      virtual void         writeChaseRegisters(std::ostream &outputFile, UINT_32 chains);
+
+      virtual void         writeInstruction(std::ostream &outputFile, Instruction *instructionIn, OperandList &operandList) = 0;
+      virtual void         writeLabel(std::ostream &outputFile, const std::string &label) = 0;
+
+      virtual void         writeCounterReset(std::ostream &outputFile, const std::string &counter, INT_32 value) = 0;
+      virtual void         writeLoopBranch(std::ostream &outputFile, const std::string &counter, UINT_32 iterations, const std::string &label) = 0;
+
+   protected:
+      static std::string   variableName(const std::string &operand);
+};
+
+#endif
@@ -13,16 +13,23 @@
 /////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////////
 
-
+#include <cstdlib>
+#include <algorithm>
+#include <cmath>
 
 #include "Body.h"
+#include "Stats.h"
+#include "Backend.h"
+#include "AsmPacker.h"
 
-Body::Body() : basicBlockLabel(0), globalBase(0), maxGlobalOffset(0), privateBase(0), maxPrivateOffset(0), globalLoadBase(0), privateLoadBase(0), globalStoreBase(0), privateStoreBase(0), privLoad(0), privStore(0), sharedLoad(0), sharedStore(0), noOverlap(0), currentLockedOffset(-1)
+Body::Body() : basicBlockLabel(0), globalBase(0), maxGlobalOffset(0), privateBase(0), maxPrivateOffset(0), globalLoadBase(0), privateLoadBase(0), globalStoreBase(0), privateStoreBase(0), privLoad(0), privStore(0), sharedLoad(0), sharedStore(0), noOverlap(0), currentLockedOffset(-1), txMode(TxMacro), lockStripes(1), bufferingTx(0), runtime(RuntimeSesc), measure(0), txLatency(0), txLatencySample(1), cacheLine(CACHE_LINE), falseSharing(0.0), workingSet(0), workingSetWindows(0), hugePages(0), prefault(0), firstTouch(0), zipfActive(0), zipfSkew(0.0), zipfCDFSkew(-1.0), threadPattern(MemLine), threadPatternParameter(0), chaseChains(0), condBranches(0), branchLabel(0), backend(0), splitOutput(0), sharedCode(0), codeThreads(0)
 {
 }
 
-Body::Body(Skin &skinIn) : basicBlockLabel(0), globalBase(0), maxGlobalOffset(0), privateBase(0), maxPrivateOffset(0), globalLoadBase(0), privateLoadBase(0), globalStoreBase(0), privateStoreBase(0), privLoad(0), privStore(0), sharedLoad(0), sharedStore(0), noOverlap(0), currentLockedOffset(-1), Skin(skinIn)
+Body::Body(Skin &skinIn) : basicBlockLabel(0), globalBase(0), maxGlobalOffset(0), privateBase(0), maxPrivateOffset(0), globalLoadBase(0), privateLoadBase(0), globalStoreBase(0), privateStoreBase(0), privLoad(0), privStore(0), sharedLoad(0), sharedStore(0), noOverlap(0), currentLockedOffset(-1), txMode(TxMacro), lockStripes(1), bufferingTx(0), runtime(RuntimeSesc), measure(0), txLatency(0), txLatencySample(1), cacheLine(CACHE_LINE), falseSharing(0.0), workingSet(0), workingSetWindows(0), hugePages(0), prefault(0), firstTouch(0), zipfActive(0), zipfSkew(0.0), zipfCDFSkew(-1.0), threadPattern(MemLine), threadPatternParameter(0), chaseChains(0), condBranches(0), branchLabel(0), backend(0), splitOutput(0), sharedCode(0), codeThreads(0), Skin()
 {
+   //take over the instruction streams rather than copying them
+   Skin::swap(skinIn);
 }
 
 /**
@@ -61,20 +68,168 @@ void Body::writeProgram(void)
    std::deque< Instruction * >::iterator instructionList_it;
 
    std::string currentFileName;
-   std::string fileName = "output/";
-   fileName = fileName + config->read<string>("Global", "fileName");
+   std::string outputDir = "output/";
+   if(config->keyExists("Global", "outputDir"))
+      outputDir = config->read<string>("Global", "outputDir") + "/";
+   std::string fileName = outputDir + config->read<string>("Global", "fileName");
 
    /* Processes */
+   txMode = TxMacro;
+   if(config->keyExists("Global", "txMode"))
+   {
+      std::string modeName = config->read<string>("Global", "txMode");
+
+      if(modeName == "itm")
+         txMode = TxItm;
+      else if(modeName == "globalLock")
+         txMode = TxGlobalLock;
+      else if(modeName == "spinLock")
+         txMode = TxSpinLock;
+      else if(modeName == "stripedLock")
+         txMode = TxStripedLock;
+   }
+
+   measure = 0;
+   if(config->keyExists("Global", "measure"))
+      measure = config->read<BOOL>("Global", "measure");
+
+   txLatency = 0;
+   if(config->keyExists("Global", "txLatency"))
+      txLatency = config->read<BOOL>("Global", "txLatency");
+
+   txLatencySample = 1;
+   if(config->keyExists("Global", "txLatencySample"))
+      txLatencySample = config->read<unsigned int>("Global", "txLatencySample");
+
+   runtime = RuntimeSesc;
+   if(config->keyExists("Global", "runtime") && config->read<string>("Global", "runtime") == "pthread")
+      runtime = RuntimePthread;
+
+   cacheLine = CACHE_LINE;
+   if(config->keyExists("Global", "cacheLineSize"))
+      cacheLine = config->read<unsigned int>("Global", "cacheLineSize");
+
+   falseSharing = 0.0;
+   if(config->keyExists("Global", "falseSharing"))
+      falseSharing = config->read<double>("Global", "falseSharing");
+
+   hugePages = prefault = firstTouch = 0;
+   if(config->keyExists("Global", "hugePages"))
+      hugePages = config->read<BOOL>("Global", "hugePages");
+   if(config->keyExists("Global", "prefault"))
+      prefault = config->read<BOOL>("Global", "prefault");
+   if(config->keyExists("Global", "firstTouch"))
+      firstTouch = config->read<BOOL>("Global", "firstTouch");
+
+   workingSet = 0;
+   if(config->keyExists("Global", "workingSetSize"))
+      workingSet = byteSize(config->read<string>("Global", "workingSetSize"));
+   workingSetWindows = (workingSet + WS_WINDOW - 1) / WS_WINDOW;
+
+   //the shared base moves one window per iteration, so fewer iterations leave part of the shared set untouched
+   UINT_32 loops = config->keyExists("Global", "numLoops") ? config->read<unsigned int>("Global", "numLoops") : 1;
+   if(workingSetWindows > 1 && loops < workingSetWindows)
+      std::cerr << "Warning: numLoops (" << loops << ") covers only " << loops << " of the " << workingSetWindows << " shared working-set windows." << std::endl;
+
+   //by default every line of the 16-bit shared window gets its own lock
+   lockStripes = (_15_BIT_RANGE + 1) / cacheLine;
+   if(config->keyExists("Global", "lockStripes"))
+      lockStripes = config->read<unsigned int>("Global", "lockStripes");
+   bufferingTx = 0;
+
+   //asm is not allowed inside __transaction_atomic, so itm defaults to (and requires) plain C
+   if(config->keyExists("Global", "backend"))
+      backend = Backend::create(config->read<string>("Global", "backend"));
+   else if(txMode == TxItm)
+      backend = Backend::create("c");
+   else
+      backend = Backend::create("mips");
+
+   //each thread in its own translation unit, so the program builds with make -j
+   splitOutput = 0;
+   if(config->keyExists("Global", "splitOutput"))
+      splitOutput = config->read<BOOL>("Global", "splitOutput");
+   globalDefinitions.clear();
+
+   //homogeneous threads can run one stream; numThreads then counts the threads that run it
+   codeThreads = numThreads;
+   sharedCode = 0;
+   if(config->keyExists("Global", "sharedCode"))
+      sharedCode = config->read<BOOL>("Global", "sharedCode");
+   if(sharedCode == 1)
+      numThreads = config->read<unsigned int>("Global", "numThreads");
+
+   //most instructions per asm statement once a file is packed; 0 or 1 leaves it as written
+   UINT_32 compactEmission = 0;
+   if(config->keyExists("Global", "compactEmission"))
+      compactEmission = config->read<unsigned int>("Global", "compactEmission");
+
+   //the pthread runtime travels with the program
+   if(runtime == RuntimePthread)
+   {
+      std::string runtimeFileName = outputDir + "param_runtime.h";
+      std::ofstream runtimeFile(runtimeFileName.c_str(), std::ios::trunc);
+      if(!runtimeFile)
+         std::cerr << "Error opening file.\n";
+
+      runtimeGen(runtimeFile);
+      runtimeFile.close();
+   }
+
+   //the chase region and its registers are only written when some cell walks a chain
+   chaseChains = 0;
+   for(THREAD_ID threadID = 0; threadID < codeThreads; threadID++)
+   {
+      for(instructionList_it = perThread_instructionList[threadID]->begin(); instructionList_it != perThread_instructionList[threadID]->end(); instructionList_it++)
+      {
+         if((*instructionList_it)->get_opCode() == iLoad && (*instructionList_it)->get_subCode() == MemChase)
+            chaseChains = std::max(chaseChains, UINT_32((*instructionList_it)->get_immediate() + 1));
+      }
+   }
+
+   //so are the branch outcome tables
+   condBranches = 0;
+   for(THREAD_ID threadID = 0; threadID < codeThreads && condBranches == 0; threadID++)
+   {
+      for(instructionList_it = perThread_instructionList[threadID]->begin(); instructionList_it != perThread_instructionList[threadID]->end(); instructionList_it++)
+      {
+         if((*instructionList_it)->get_opCode() == iBJ && (*instructionList_it)->get_subCode() == BJCond)
+         {
+            condBranches = 1;
+            break;
+         }
+      }
+   }
+
+   //the shared header comes first, since main's file defines what it declares
+   if(splitOutput == 1)
+   {
+      std::ofstream headerFile((fileName + ".h").c_str(), std::ios::trunc);
+      if(!headerFile)
+         std::cerr << "Error opening file.\n";
+
+      splitHeaderGen(headerFile);
+      headerFile.close();
+
+      makefileGen(outputDir);
+   }
+
    std::cout << "Writing synthetic program to " << fileName << " -- ";
-   for(THREAD_ID threadID = 0; threadID < numThreads; threadID++)
+   for(THREAD_ID threadID = 0; threadID < codeThreads; threadID++)
    {
       std::cout << "T" << threadID << "..." << std::flush;
+      Stats::beginStage("writeProgram", threadID);
 
       //set the working list equal to the current thread's instruction list
       instructionList = perThread_instructionList[threadID];
 
       //reset the label count for each thread
       basicBlockLabel = 0;
+      branchLabel = 0;
+
+      //cells without their own pattern use the thread's, then the global one
+      AccessPattern::parse(accessPatternSpec(config, threadID), threadPattern, threadPatternParameter);
+      setAccessPattern(threadPattern, threadPatternParameter);
 
       //reset the base of the private memory region
       privateBase = globalBase = globalLoadBase = globalStoreBase = privateLoadBase = privateStoreBase = 0;
@@ -94,10 +249,12 @@ void Body::writeProgram(void)
       currentLockedOffset = -1;
 
       //set up the new name -- you know 'cause naming is important
-      if(threadID == 0)
+      if(sharedCode == 1)
+         currentFileName = fileName + "_shared" + (splitOutput == 1 ? ".c" : ".h");
+      else if(threadID == 0)
          currentFileName = fileName + ".c";
       else
-         currentFileName = fileName + "_" + Instruction::IntToString(threadID) + ".h";
+         currentFileName = fileName + "_" + Instruction::IntToString(threadID) + (splitOutput == 1 ? ".c" : ".h");
 
       //open the file
       std::ofstream outputFile(currentFileName.c_str(), std::ios::trunc);   //open a file for writing (append the current contents)
@@ -105,13 +262,13 @@ void Body::writeProgram(void)
          std::cerr << "Error opening file.\n";
 
       //set up the head
-      if(threadID == 0)
+      if(threadID == 0 && sharedCode == 0)
          headerGen(outputFile);
       else
          funcHeaderGen(threadID, outputFile);
 
-      //insert specials
-      if(barrier_per_thread == 1)
+      //insert specials -- a measured run, or one that places its pages, also waits until every thread is ready
+      if(barrier_per_thread == 1 || measure == 1 || hugePages == 1 || prefault == 1 || firstTouch == 1)
       {
          insertBarrier(outputFile, numThreads);
       }
@@ -129,16 +286,30 @@ void Body::writeProgram(void)
       {
          OperandList operandList;
 
-         if((*instructionList_it)->get_opCode() == iBJ)
+         //a striped-lock transaction is held back until its lock set is known
+         std::ostream &sectionFile = bufferingTx ? static_cast< std::ostream & >(txBuffer) : outputFile;
+
+         if((*instructionList_it)->get_opCode() == iBJ && (*instructionList_it)->get_subCode() == BJCond)
          {
+            //the outcome is the thread's next table entry
+            sectionFile << "   branch_bit = param_branch_table[" << threadIndex(threadID) << "][branch_index++ & " << BRANCH_TABLE - 1 << "];\n";
 
             translateInstruction(threadID, (*instructionList_it), operandList);
-            writeInstruction(outputFile, (*instructionList_it), operandList);
-            writeLabel(outputFile, threadID);
+            writeInstruction(sectionFile, (*instructionList_it), operandList);
+         }
+         else if((*instructionList_it)->get_opCode() == iBJ)
+         {
+
+            translateInstruction(threadID, (*instructionList_it), operandList);
+            writeInstruction(sectionFile, (*instructionList_it), operandList);
+            writeLabel(sectionFile, threadID);
 
             //starting a new cell, reset private flags
             privLoad = privStore = 0;
 
+            //the next cell follows the thread's pattern unless it leads with its own
+            setAccessPattern(threadPattern, threadPatternParameter);
+
             //only do this if memory is reset at the start of each cell
             if(reset_mem_per_cell == 1)
             {
@@ -152,68 +323,85 @@ void Body::writeProgram(void)
          }
          else if((*instructionList_it)->get_opCode() == syncBarrier)
          {
-            insertBarrier(outputFile, numThreads);
+            insertBarrier(sectionFile, numThreads);
+         }
+         else if((*instructionList_it)->get_opCode() == iMemPattern)
+         {
+            setAccessPattern((*instructionList_it)->get_subCode(), (*instructionList_it)->get_immediate());
          }
          else if((*instructionList_it)->get_opCode() == iBeginTX)
          {
             if(barrier_per_transaction == 1)
             {
-               insertBarrier(outputFile, numThreads);
+               insertBarrier(sectionFile, numThreads);
             }
-            startTransSection(outputFile, 0);
+            startTransSection(sectionFile, 0);
 
             //If the conflict model is high we need to ensure there are no overlapping l/s between the pair
             if((*instructionList_it)->get_conflictModel() == High)
                noOverlap = 1;
             else
                noOverlap = 0;
+
+            //Zipf sections draw their shared lines from the skewed distribution (skew in thousandths)
+            zipfActive = (*instructionList_it)->get_conflictModel() == Zipf;
+            if(zipfActive == 1)
+               zipfSkew = (*instructionList_it)->get_immediate() / 1000.0;
          }
          else if((*instructionList_it)->get_opCode() == iCommitTX)
          {
             noOverlap = 0;
+            zipfActive = 0;
             endTransSection(outputFile, 0);
+
+            if(measure == 1)
+               outputFile << "   PARAM_TX_COMMITTED(" << threadIndex(threadID) << ");\n";
          }
          else if((*instructionList_it)->get_opCode() == iInitLoop)
          {
             if((*instructionList_it)->get_subCode() == CellLoop)
-               initCellLoopSection(outputFile);
+               initCellLoopSection(sectionFile);
+            else if((*instructionList_it)->get_subCode() == NestedCellLoop)
+               initNestedCellLoopSection(sectionFile, (*instructionList_it)->get_immediate());
          }
          else if((*instructionList_it)->get_opCode() == iBeginLoop)
          {
-            if((*instructionList_it)->get_subCode() == CellLoop)
-               beginCellLoopSection(outputFile, threadID);
+            if((*instructionList_it)->get_subCode() == CellLoop || (*instructionList_it)->get_subCode() == NestedCellLoop)
+               beginCellLoopSection(sectionFile, threadID);
             else if((*instructionList_it)->get_subCode() == MultiCellLoop)
             {
                instructionID = (*instructionList_it)->get_instructionID();
-               beginMultiCellLoopSection(outputFile, threadID, instructionID);
+               beginMultiCellLoopSection(sectionFile, threadID, instructionID);
             }
             else
             {
                instructionID = (*instructionList_it)->get_instructionID();
-               beginBlockLoopSection(outputFile, threadID, instructionID);
+               beginBlockLoopSection(sectionFile, threadID, instructionID);
             }
          }
          else if((*instructionList_it)->get_opCode() == iEndLoop)
          {
             if((*instructionList_it)->get_subCode() == CellLoop)
-               endCellLoopSection(outputFile, threadID, (*instructionList_it)->get_iterations());
+               endCellLoopSection(sectionFile, threadID, (*instructionList_it)->get_iterations());
+            else if((*instructionList_it)->get_subCode() == NestedCellLoop)
+               endNestedCellLoopSection(sectionFile, threadID, (*instructionList_it)->get_iterations(), (*instructionList_it)->get_immediate());
             else if((*instructionList_it)->get_subCode() == MultiCellLoop)
-               endMultiCellLoopSection(outputFile, threadID, instructionID, (*instructionList_it)->get_iterations());
+               endMultiCellLoopSection(sectionFile, threadID, instructionID, (*instructionList_it)->get_iterations());
             else
-               endBlockLoopSection(outputFile, threadID, instructionID, (*instructionList_it)->get_iterations());
+               endBlockLoopSection(sectionFile, threadID, instructionID, (*instructionList_it)->get_iterations());
          }
          else
          {
             translateInstruction(threadID, (*instructionList_it), operandList);
-            writeInstruction(outputFile, (*instructionList_it), operandList);
+            writeInstruction(sectionFile, (*instructionList_it), operandList);
          }
       }
 
       //insert specials
-      endProgamIterations(outputFile);
+      endProgamIterations(outputFile, threadID);
 
       //set up the tail
-      if(threadID == 0)
+      if(threadID == 0 && sharedCode == 0)
       {
          insertWait(outputFile, numThreads);
          trailerGen(outputFile);
@@ -224,8 +412,20 @@ void Body::writeProgram(void)
       }
 
       //clean up
+      Stats::endStage(perThread_numCells[threadID], instructionList->size(), outputFile.tellp());
       outputFile.close();
 
+      if(compactEmission > 1)
+      {
+         Stats::beginStage("compactEmission", threadID);
+         AsmPacker packer(compactEmission);
+         UINT_64 bytesWritten = packer.packFile(currentFileName);
+         Stats::endStage(perThread_numCells[threadID], packer.get_statementsIn(), bytesWritten);
+      }
+
+      //this thread's stream has been written, so it can go
+      releaseInstructions(threadID);
+
       delete addressMatch;
 
       delete globalLoadOffsetList;
@@ -235,9 +435,301 @@ void Body::writeProgram(void)
       delete privateStoreOffsetList;
    }
 
+   //main sets up the regions and runs the shared function as thread 0
+   if(sharedCode == 1)
+   {
+      std::cout << "main..." << std::flush;
+
+      std::ofstream mainFile((fileName + ".c").c_str(), std::ios::trunc);
+      if(!mainFile)
+         std::cerr << "Error opening file.\n";
+
+      headerGen(mainFile);
+      mainFile << "   threadFunc((void*)0);\n";
+      insertWait(mainFile, numThreads);
+      trailerGen(mainFile);
+      mainFile.close();
+   }
+
+   delete backend;
+   backend = 0;
+
    std::cout << "It's ALIVE!" << std::endl;
 }
 
+/**
+ * @ingroup Body
+ * @brief   Checks the options writeProgram reads, so a bad one stops param before anything is written
+ *
+ * @param configIn Configuration with the command-line options already added
+ * @return 0 if any option is out of range
+ */
+BOOL Body::checkOptions(Config *configIn)
+{
+   /* Variables */
+   BOOL valid = 1;
+   std::string modeName = "macro";
+   InstSubType pattern;
+   UINT_32 parameter;
+
+   /* Processes */
+   if(configIn->keyExists("Global", "txMode"))
+      modeName = configIn->read<string>("Global", "txMode");
+   if(modeName != "macro" && modeName != "itm" && modeName != "globalLock" && modeName != "spinLock" && modeName != "stripedLock")
+   {
+      std::cerr << "Unknown txMode \"" << modeName << "\" -- expected macro, itm, globalLock, spinLock or stripedLock." << std::endl;
+      valid = 0;
+   }
+
+   if(configIn->keyExists("Global", "txLatencySample") && configIn->read<unsigned int>("Global", "txLatencySample") == 0)
+   {
+      std::cerr << "txLatencySample must be at least 1." << std::endl;
+      valid = 0;
+   }
+
+   if(configIn->keyExists("Global", "runtime"))
+   {
+      std::string runtimeName = configIn->read<string>("Global", "runtime");
+      if(runtimeName != "sesc" && runtimeName != "pthread")
+      {
+         std::cerr << "Unknown runtime \"" << runtimeName << "\" -- expected sesc or pthread." << std::endl;
+         valid = 0;
+      }
+   }
+
+   if(configIn->keyExists("Global", "cacheLineSize"))
+   {
+      UINT_32 line = configIn->read<unsigned int>("Global", "cacheLineSize");
+      if(line < 2 * INT_SIZE || line > 4096 || (line & (line - 1)) != 0)
+      {
+         std::cerr << "cacheLineSize must be a power of two between " << 2 * INT_SIZE << " and 4096." << std::endl;
+         valid = 0;
+      }
+   }
+
+   if(configIn->keyExists("Global", "falseSharing"))
+   {
+      double fraction = configIn->read<double>("Global", "falseSharing");
+      if(fraction < 0.0 || fraction > 1.0)
+      {
+         std::cerr << "falseSharing must be between 0 and 1." << std::endl;
+         valid = 0;
+      }
+   }
+
+   if(configIn->keyExists("Global", "workingSetSize"))
+      byteSize(configIn->read<string>("Global", "workingSetSize"));
+
+   if(configIn->keyExists("Global", "lockStripes") && configIn->read<unsigned int>("Global", "lockStripes") == 0)
+   {
+      std::cerr << "lockStripes must be at least 1." << std::endl;
+      valid = 0;
+   }
+
+   //asm is not allowed inside __transaction_atomic
+   if(configIn->keyExists("Global", "backend"))
+   {
+      Backend *probe = Backend::create(configIn->read<string>("Global", "backend"));
+      if(modeName == "itm" && probe->get_name() != "c")
+      {
+         std::cerr << "txMode itm needs the c backend (" << probe->get_name() << " writes inline assembly)." << std::endl;
+         valid = 0;
+      }
+      delete probe;
+   }
+
+   //the global pattern, then each thread's own
+   for(INT_32 threadID = -1; threadID < INT_32(configIn->read<unsigned int>("Global", "numThreads")); threadID++)
+   {
+      std::string region = threadID < 0 ? std::string("Global") : "Thread" + Instruction::IntToString(threadID);
+      if(!configIn->keyExists(region, "accessPattern"))
+         continue;
+
+      std::string patternSpec = configIn->read<string>(region, "accessPattern");
+      if(AccessPattern::parse(patternSpec, pattern, parameter) == 0)
+      {
+         std::cerr << "Unknown access pattern \"" << patternSpec << "\" -- expected line, stride:N, stream, interleave:K or randomPage." << std::endl;
+         valid = 0;
+      }
+   }
+
+   return valid;
+}
+
+/**
+ * @ingroup Body
+ * @brief   A thread's access pattern -- its own, then the global one, then line
+ */
+std::string Body::accessPatternSpec(Config *configIn, THREAD_ID threadID)
+{
+   std::string threadRegion = "Thread" + Instruction::IntToString(threadID);
+
+   if(configIn->keyExists(threadRegion, "accessPattern"))
+      return configIn->read<string>(threadRegion, "accessPattern");
+   else if(configIn->keyExists("Global", "accessPattern"))
+      return configIn->read<string>("Global", "accessPattern");
+
+   return "line";
+}
+
+/**
+ * @ingroup Body
+ * @brief   Parses a byte count with an optional K, M or G suffix
+ *
+ * @param sizeIn e.g. 64M
+ * @return Size in bytes
+ */
+UINT_64 Body::byteSize(const std::string &sizeIn)
+{
+   /* Variables */
+   char *suffix;
+   UINT_64 size = strtoull(sizeIn.c_str(), &suffix, 10);
+
+   /* Processes */
+   switch(*suffix)
+   {
+      case 'g': case 'G': size = size << 30; suffix++; break;
+      case 'm': case 'M': size = size << 20; suffix++; break;
+      case 'k': case 'K': size = size << 10; suffix++; break;
+   }
+
+   if(*suffix != '\0' && *suffix != 'b' && *suffix != 'B')
+   {
+      std::cerr << "Bad size \"" << sizeIn << "\" -- expected bytes with an optional K, M or G suffix." << std::endl;
+      exit(1);
+   }
+
+   return size;
+}
+
+/**
+ * @ingroup Body
+ * @brief   Ints allocated for each private and shared region
+ *
+ * A working set spans workingSetWindows windows; one extra window covers offsets past the last base.
+ */
+UINT_64 Body::regionSize(void) const
+{
+   UINT_64 memSize = MEM_REGION(cacheLine);
+
+   if(workingSet > 0)
+      memSize = std::max(memSize, (UINT_64(workingSetWindows) + 1) * WS_WINDOW / INT_SIZE);
+
+   return memSize;
+}
+
+/**
+ * @ingroup Body
+ * @brief   Draws a rank in [0, n) with probability proportional to 1 / (rank + 1)^zipfSkew
+ *
+ * @param n Number of candidates, hottest first
+ * @return Rank
+ *
+ * The cumulative weights are kept for every line of the shared window and rebuilt only when the
+ * skew changes; a draw over the first n candidates is a binary search of that prefix.
+ */
+UINT_32 Body::zipfRank(UINT_32 n)
+{
+   /* Variables */
+   UINT_32 const numLines = (_15_BIT_RANGE + 1) / cacheLine - 1;
+
+   /* Processes */
+   if(zipfCDF.size() != numLines || zipfCDFSkew != zipfSkew)
+   {
+      double total = 0.0;
+
+      zipfCDF.resize(numLines);
+      for(UINT_32 rank = 0; rank < numLines; rank++)
+      {
+         total = total + 1.0 / pow(rank + 1.0, zipfSkew);
+         zipfCDF[rank] = total;
+      }
+      zipfCDFSkew = zipfSkew;
+   }
+
+   n = std::min(std::max(n, UINT_32(1)), numLines);
+
+   double draw = uniformNormRV() * zipfCDF[n - 1];
+   UINT_32 rank = std::lower_bound(zipfCDF.begin(), zipfCDF.begin() + n, draw) - zipfCDF.begin();
+
+   return std::min(rank, n - 1);
+}
+
+/**
+ * @ingroup Body
+ * @brief   Places a unique shared reference on a Zipf-drawn line not yet in the pool
+ *
+ * @param offsetList Used offsets of this kind (loads or stores); the new offset is added to it
+ * @return Offset of the line
+ *
+ * Every thread draws from the same ranking, so the hottest lines are shared by all of them. If the
+ * draws keep landing on used lines, the hottest unused line is taken instead.
+ */
+UINT_32 Body::zipfUniqueOffset(std::vector< UINT_32 > *offsetList)
+{
+   /* Variables */
+   UINT_32 const numLines = (_15_BIT_RANGE + 1) / cacheLine - 1;
+   UINT_32 offset = 0;
+
+   /* Processes */
+   for(UINT_32 attempt = 0; attempt < 32; attempt++)
+   {
+      offset = zipfRank(numLines) * cacheLine;
+      if(std::find(offsetList->begin(), offsetList->end(), offset) == offsetList->end())
+      {
+         offsetList->push_back(offset);
+         return offset;
+      }
+   }
+
+   for(UINT_32 rank = 0; rank < numLines; rank++)
+   {
+      if(std::find(offsetList->begin(), offsetList->end(), rank * cacheLine) == offsetList->end())
+      {
+         offsetList->push_back(rank * cacheLine);
+         return rank * cacheLine;
+      }
+   }
+
+   //every line is already in use
+   return offset;
+}
+
+/**
+ * @ingroup Body
+ * @brief   Points all four unique-offset streams at one access pattern
+ *
+ * @param pattern MemLine, MemStride, MemStream, MemInterleave or MemRandomPage
+ * @param parameter Stride in bytes or number of interleaved streams
+ */
+void Body::setAccessPattern(InstSubType pattern, UINT_32 parameter)
+{
+   globalLoadPattern.set(pattern, parameter, cacheLine);
+   globalStorePattern.set(pattern, parameter, cacheLine);
+   privateLoadPattern.set(pattern, parameter, cacheLine);
+   privateStorePattern.set(pattern, parameter, cacheLine);
+}
+
+/**
+ * @ingroup Body
+ * @brief   Whether a private line is placed in the false-sharing region
+ *
+ * @param privateOffset
+ * @return True for about falseSharing of all lines
+ *
+ * The choice hashes the line rather than drawing a random number, so every reference to a line
+ * (including matched pairs) agrees and the rest of the generated stream is unchanged.
+ */
+BOOL Body::isFalselyShared(UINT_32 privateOffset) const
+{
+   UINT_32 line = privateOffset / cacheLine;
+
+   if(falseSharing <= 0.0)
+      return 0;
+
+   return ((line * 2654435761u) >> 16) % 1024 < falseSharing * 1024;
+}
+
 /**
  * @ingroup Body
  * @brief   Determines asm from high-level specification
@@ -253,31 +745,49 @@ void Body::translateInstruction(THREAD_ID threadID, Instruction *instructionIn,
    UINT_32 privateOffset;
 
    /* Processes */
-   if(instructionIn->get_opCode() == iALU)
+   if(instructionIn->is_intArithmetic())
    {
       operandList.rs = "%1";
       operandList.rt = "%2";
       operandList.rd = "%0";
 
-      operandList.rs_variable = Instruction::getIntVariable(instructionIn->get_rs());
-      operandList.rt_variable = Instruction::getIntVariable(instructionIn->get_rt());
-      operandList.rd_variable = Instruction::getIntVariable(instructionIn->get_rd());
+      operandList.rs_variable = backend->intVariable(instructionIn->get_rs());
+      operandList.rt_variable = backend->intVariable(instructionIn->get_rt());
+      operandList.rd_variable = backend->intVariable(instructionIn->get_rd());
    }
-   else if(instructionIn->get_opCode() == fpALU)
+   else if(instructionIn->is_fpArithmetic())
    {
       operandList.rs = "%1";
       operandList.rt = "%2";
       operandList.rd = "%0";
 
-      operandList.rs_variable = Instruction::getFPVariable(instructionIn->get_rs());
-      operandList.rt_variable = Instruction::getFPVariable(instructionIn->get_rt());
-      operandList.rd_variable = Instruction::getFPVariable(instructionIn->get_rd());
+      operandList.rs_variable = backend->fpVariable(instructionIn->get_rs());
+      operandList.rt_variable = backend->fpVariable(instructionIn->get_rt());
+      operandList.rd_variable = backend->fpVariable(instructionIn->get_rd());
+   }
+   else if(instructionIn->get_opCode() == iLoad && instructionIn->get_subCode() == MemChase)
+   {
+      //the address is the node the chain's previous load returned
+      std::string chase = "r\"(chase_" + Instruction::IntToString(instructionIn->get_immediate()) + ")";
+
+      operandList.rs = "0(%1)";
+      operandList.offSet = 0;
+      operandList.rs_variable = chase;
+
+      operandList.rt = "";
+      operandList.rd = "%0";
+      operandList.rd_variable = chase;
    }
    else if(instructionIn->get_opCode() == iLoad)
    {
       std::map< UINT_32, ADDRESS_INT >::iterator matchIterator;
 
-      if(instructionIn->get_isUnique() == 1)
+      if(instructionIn->get_isUnique() == 1 && instructionIn->get_isShared() == 1 && zipfActive == 1)
+      {
+         globalOffset = zipfUniqueOffset(globalLoadOffsetList);
+         privateOffset = privateLoadBase;
+      }
+      else if(instructionIn->get_isUnique() == 1)
       {
          ///NOTE Stopped here
          if(instructionIn->get_isShared() == 1 && sharedLoad == 0 && instructionIn->get_physicalAddress() != 0)
@@ -304,7 +814,7 @@ void Body::translateInstruction(THREAD_ID threadID, Instruction *instructionIn,
          }
          else if(instructionIn->get_isShared() == 1)
          {
-            globalLoadBase = globalLoadBase + CACHE_LINE;
+            globalLoadBase = globalLoadPattern.next(globalLoadBase);
             if(globalLoadBase > _15_BIT_RANGE)
             {
                std::cerr << "\nWARNING -- Load (" << globalLoadBase << std::dec << ") exceeded 16-bit address. Reset global load and store offsets." << std::endl;
@@ -322,7 +832,7 @@ void Body::translateInstruction(THREAD_ID threadID, Instruction *instructionIn,
                      if(globalLoadBase == *temp_it)
                      {
                         searching = 1;
-                        globalLoadBase = globalLoadBase + CACHE_LINE;
+                        globalLoadBase = globalLoadPattern.next(globalLoadBase);
                         break;
                      }
                      else
@@ -349,7 +859,7 @@ void Body::translateInstruction(THREAD_ID threadID, Instruction *instructionIn,
          }
          else if(privLoad == 1)
          {
-            privateLoadBase = privateLoadBase + CACHE_LINE;
+            privateLoadBase = privateLoadPattern.next(privateLoadBase);
             if(privateLoadBase > _15_BIT_RANGE)
             {
                std::cerr << "\nWARNING -- Load exceeded 16-bit address. Reset private load offset." << std::endl;
@@ -362,7 +872,7 @@ void Body::translateInstruction(THREAD_ID threadID, Instruction *instructionIn,
          }
 
          //if we're out of the bounds for the memory pool, exit
-         if(globalLoadBase > MAX_MEM || privateLoadBase > MAX_MEM)
+         if(globalLoadBase > MAX_MEM(cacheLine) || privateLoadBase > MAX_MEM(cacheLine))
          {
             std::cerr << "Memory Bound (" << globalLoadBase << " - " << privateLoadBase << ")" << std::endl;
             exit(1);
@@ -373,7 +883,7 @@ void Body::translateInstruction(THREAD_ID threadID, Instruction *instructionIn,
       }
       else
       {
-         UINT_32 globalRef = randMemory(0, globalLoadOffsetList->size());
+         UINT_32 globalRef = zipfActive == 1 ? zipfRank(globalLoadOffsetList->size()) : randMemory(0, globalLoadOffsetList->size());
          UINT_32 privateRef = randMemory(0, privateLoadOffsetList->size());
 
          globalOffset = (*globalLoadOffsetList)[globalRef];
@@ -399,7 +909,11 @@ void Body::translateInstruction(THREAD_ID threadID, Instruction *instructionIn,
          }
 
          operandList.rs = Instruction::IntToString(globalOffset) + "(%1)";
-         operandList.rs_variable =  "r\"(s_data_out_int)";
+         operandList.offSet = globalOffset;
+
+         if(bufferingTx == 1)
+            txStripes.insert((globalOffset / cacheLine) % lockStripes);
+         operandList.rs_variable =  workingSetWindows > 1 ? "r\"(s_window)" : "r\"(s_data_out_int)";
       }
       else
       {
@@ -417,20 +931,38 @@ void Body::translateInstruction(THREAD_ID threadID, Instruction *instructionIn,
             #endif
          }
 
-         operandList.rs = Instruction::IntToString(privateOffset) + "(%1)";
-         operandList.rs_variable =  "r\"(data_out_int)";
+         //a falsely shared line puts this thread's word next to the other threads' words
+         if(isFalselyShared(privateOffset))
+         {
+            UINT_32 falseOffset = (privateOffset / cacheLine) * cacheLine + (threadID % (cacheLine / INT_SIZE)) * INT_SIZE;
+
+            operandList.rs = Instruction::IntToString(falseOffset) + "(%1)";
+            operandList.offSet = falseOffset;
+            operandList.rs_variable =  "r\"(fs_data_out_tid)";
+         }
+         else
+         {
+            operandList.rs = Instruction::IntToString(privateOffset) + "(%1)";
+            operandList.offSet = privateOffset;
+            operandList.rs_variable =  "r\"(data_out_int)";
+         }
       }
 
       operandList.rt = "";
       operandList.rd = "%0";
 
-      operandList.rd_variable = Instruction::getIntVariable(instructionIn->get_rd());
+      operandList.rd_variable = backend->intVariable(instructionIn->get_rd());
    }
    else if(instructionIn->get_opCode() == iStore)
    {
       std::map< UINT_32, ADDRESS_INT >::iterator matchIterator;
 
-      if(instructionIn->get_isUnique() == 1)
+      if(instructionIn->get_isUnique() == 1 && instructionIn->get_isShared() == 1 && zipfActive == 1)
+      {
+         globalOffset = zipfUniqueOffset(globalStoreOffsetList);
+         privateOffset = privateStoreBase;
+      }
+      else if(instructionIn->get_isUnique() == 1)
       {
          if(instructionIn->get_isShared() == 1 && sharedStore == 0)
          {
@@ -447,7 +979,7 @@ void Body::translateInstruction(THREAD_ID threadID, Instruction *instructionIn,
                {
                   if(matchIterator->second == 0)
                   {
-                     globalStoreBase = globalStoreBase + CACHE_LINE;
+                     globalStoreBase = globalStorePattern.next(globalStoreBase);
 
                      //If we want to prevent interleaving overlap, we need to make sure that loads and stores do not touch
                      if(noOverlap == 1)
@@ -463,7 +995,7 @@ void Body::translateInstruction(THREAD_ID threadID, Instruction *instructionIn,
                               {
                                  searching = 1;
                                  lastOffset = globalStoreBase;
-                                 globalStoreBase = globalStoreBase + CACHE_LINE;
+                                 globalStoreBase = globalStorePattern.next(globalStoreBase);
 
                                  if(globalStoreBase > _15_BIT_RANGE)
                                  {
@@ -493,7 +1025,7 @@ void Body::translateInstruction(THREAD_ID threadID, Instruction *instructionIn,
          }
          else if(instructionIn->get_isShared() == 1)
          {
-            globalStoreBase = globalStoreBase + CACHE_LINE;
+            globalStoreBase = globalStorePattern.next(globalStoreBase);
             if(globalStoreBase > _15_BIT_RANGE)
             {
                std::cerr << "\nWARNING -- Store (" << globalStoreBase << std::dec << ") exceeded 16-bit address. Reset global load and store offsets." << std::endl;
@@ -511,7 +1043,7 @@ void Body::translateInstruction(THREAD_ID threadID, Instruction *instructionIn,
                      if(globalStoreBase == *temp_it || globalStoreBase == currentLockedOffset)
                      {
                         searching = 1;
-                        globalStoreBase = globalStoreBase + CACHE_LINE;
+                        globalStoreBase = globalStorePattern.next(globalStoreBase);
                         break;
                      }
                      else
@@ -536,7 +1068,7 @@ void Body::translateInstruction(THREAD_ID threadID, Instruction *instructionIn,
          }
          else if(privStore = 1)
          {
-            privateStoreBase = privateStoreBase + CACHE_LINE;
+            privateStoreBase = privateStorePattern.next(privateStoreBase);
             if(privateStoreBase > _15_BIT_RANGE)
             {
                std::cerr << "\nWARNING -- Exceeded 16-bit address. Reset private store offsets." << std::endl;
@@ -549,7 +1081,7 @@ void Body::translateInstruction(THREAD_ID threadID, Instruction *instructionIn,
          }
 
 //          //if we're out of the bounds for the memory pool, exit
-//          if(globalLoadBase > MAX_MEM || privateLoadBase > MAX_MEM)
+//          if(globalLoadBase > MAX_MEM(cacheLine) || privateLoadBase > MAX_MEM(cacheLine))
 //          {
 //             std::cerr << "Memory Bound" << std::endl;
 //             exit(1);
@@ -560,7 +1092,7 @@ void Body::translateInstruction(THREAD_ID threadID, Instruction *instructionIn,
       }
       else
       {
-         UINT_32 globalRef = randMemory(0, globalStoreOffsetList->size());
+         UINT_32 globalRef = zipfActive == 1 ? zipfRank(globalStoreOffsetList->size()) : randMemory(0, globalStoreOffsetList->size());
          UINT_32 privateRef = randMemory(0, privateStoreOffsetList->size());
 
          globalOffset = (*globalStoreOffsetList)[globalRef];
@@ -584,7 +1116,11 @@ void Body::translateInstruction(THREAD_ID threadID, Instruction *instructionIn,
          }
 
          operandList.rt = Instruction::IntToString(globalOffset) + "(%0)";
-         operandList.rt_variable =  "r\"(s_data_out_int)";
+         operandList.offSet = globalOffset;
+
+         if(bufferingTx == 1)
+            txStripes.insert((globalOffset / cacheLine) % lockStripes);
+         operandList.rt_variable =  workingSetWindows > 1 ? "r\"(s_window)" : "r\"(s_data_out_int)";
       }
       else
       {
@@ -602,8 +1138,21 @@ void Body::translateInstruction(THREAD_ID threadID, Instruction *instructionIn,
             #endif
          }
 
-         operandList.rt = Instruction::IntToString(privateOffset) + "(%0)";
-         operandList.rt_variable =  "r\"(data_out_int)";
+         //a falsely shared line puts this thread's word next to the other threads' words
+         if(isFalselyShared(privateOffset))
+         {
+            UINT_32 falseOffset = (privateOffset / cacheLine) * cacheLine + (threadID % (cacheLine / INT_SIZE)) * INT_SIZE;
+
+            operandList.rt = Instruction::IntToString(falseOffset) + "(%0)";
+            operandList.offSet = falseOffset;
+            operandList.rt_variable =  "r\"(fs_data_out_tid)";
+         }
+         else
+         {
+            operandList.rt = Instruction::IntToString(privateOffset) + "(%0)";
+            operandList.offSet = privateOffset;
+            operandList.rt_variable =  "r\"(data_out_int)";
+         }
       }
 
       operandList.rs = "";
@@ -611,7 +1160,19 @@ void Body::translateInstruction(THREAD_ID threadID, Instruction *instructionIn,
 
       operandList.clobberList = operandList.clobberList + "\"memory\"";
 
-      operandList.rd_variable = Instruction::getIntVariable(instructionIn->get_rd());
+      operandList.rd_variable = backend->intVariable(instructionIn->get_rd());
+   }
+   else if(instructionIn->get_opCode() == iBJ && instructionIn->get_subCode() == BJCond)
+   {
+      branchLabel = branchLabel + 1;
+
+      operandList.rs = "%0";
+      operandList.rt = "";
+      operandList.rd =  "B" + Instruction::IntToString(threadID) + "_" + Instruction::IntToString(branchLabel) + "_";
+
+      operandList.rs_variable = "r\"(branch_bit)";
+      operandList.rt_variable = "";
+      operandList.rd_variable = "";
    }
    else if(instructionIn->get_opCode() == iBJ)
    {
@@ -635,100 +1196,9 @@ void Body::translateInstruction(THREAD_ID threadID, Instruction *instructionIn,
  * @param instructionIn
  * @param operandList
  */
-void Body::writeInstruction(std::ofstream &outputFile, Instruction *instructionIn, OperandList &operandList)
+void Body::writeInstruction(std::ostream &outputFile, Instruction *instructionIn, OperandList &operandList)
 {
-   /* Variables */
-
-   /* Processes */
-   outputFile << "   __asm__ __volatile__ ( \"";
-
-   if(instructionIn->get_opCode() == iALU)
-   {
-//       outputFile << "add";
-      outputFile << "xor";
-      if(operandList.rd != "")
-         outputFile << " "  << operandList.rd;
-      if(operandList.rs != "")
-         outputFile << ", " << operandList.rs;
-      if(operandList.rt != "")
-         outputFile << ", " << operandList.rt;
-
-      outputFile << std::setw(6) << "\"\t :";
-   }
-   else if(instructionIn->get_opCode() == fpALU)
-   {
-      outputFile << "add.d";
-      if(operandList.rd != "")
-         outputFile << " "  << operandList.rd;
-      if(operandList.rs != "")
-         outputFile << ", " << operandList.rs;
-      if(operandList.rt != "")
-         outputFile << ", " << operandList.rt;
-
-      outputFile << std::setw(6) << "\"\t :";
-   }
-   else if(instructionIn->get_opCode() == iLoad)
-   {
-      outputFile << "lw";
-      if(operandList.rd != "")
-         outputFile << " "  << operandList.rd;
-      if(operandList.rs != "")
-         outputFile << ", " << operandList.rs;
-      if(operandList.rt != "")
-         outputFile << ", " << operandList.rt;
-
-      outputFile << std::setw(6) << "\"\t :";
-   }
-   else if(instructionIn->get_opCode() == iBJ)
-   {
-      outputFile << "b";
-      if(operandList.rd != "")
-         outputFile << " "  << operandList.rd;
-      if(operandList.rs != "")
-         outputFile << ", " << operandList.rs;
-      if(operandList.rt != "")
-         outputFile << ", " << operandList.rt;
-
-      outputFile << std::setw(6) << "\"\t :";
-   }
-
-   if(instructionIn->get_opCode() == iStore)
-   {
-      outputFile << "sw";
-      if(operandList.rd != "")
-         outputFile << " "  << operandList.rd;
-      if(operandList.rs != "")
-         outputFile << ", " << operandList.rs;
-      if(operandList.rt != "")
-         outputFile << ", " << operandList.rt;
-
-      outputFile << std::setw(6) << "\"\t :";
-
-      outputFile << " \"=" << operandList.rt_variable;
-
-      outputFile << " :";
-      outputFile << " \""  << operandList.rd_variable;
-   }
-   else
-   {
-      if(operandList.rd != "" && instructionIn->get_opCode() != iBJ)
-         outputFile << " \"=" << operandList.rd_variable;
-
-      outputFile << " :";
-      if(operandList.rs != "" && operandList.rs_variable != "")
-         outputFile << " \""  << operandList.rs_variable;
-      if(operandList.rt != "" && operandList.rs == "")
-         outputFile << " \""  << operandList.rt_variable;
-      else if(operandList.rt != "")
-         outputFile << ", \"" << operandList.rt_variable;
-   }
-
-   if(operandList.clobberList.size() > 0)
-      outputFile << " : " << operandList.clobberList;
-
-   outputFile << " );";
-
-   outputFile << std::endl;
+   backend->writeInstruction(outputFile, instructionIn, operandList);
 }
 
 /**
@@ -737,12 +1207,17 @@ void Body::writeInstruction(std::ofstream &outputFile, Instruction *instructionI
  * @param outputFile 
  * @param threadID 
  */
-inline void Body::writeLabel(std::ofstream &outputFile, THREAD_ID threadID)
+inline void Body::writeLabel(std::ostream &outputFile, THREAD_ID threadID)
 {
    outputFile << "\n";
-   outputFile << "   __asm__ __volatile__ (\"";
-   outputFile << "I" + Instruction::IntToString(threadID) + "_" + Instruction::IntToString(basicBlockLabel) + "_:\");";
-   outputFile << "\n";
+   backend->writeLabel(outputFile, "I" + Instruction::IntToString(threadID) + "_" + Instruction::IntToString(basicBlockLabel) + "_");
+
+   //each cell moves the private base on to the next window of the working set
+   if(workingSetWindows > 1)
+   {
+      outputFile << "   data_out_int = data_out_int + " << WS_WINDOW << ";\n";
+      outputFile << "   if(data_out_int >= data_out_int_base + " << UINT_64(workingSetWindows) * WS_WINDOW << ") data_out_int = data_out_int_base;\n";
+   }
 }
 
 /**
@@ -751,9 +1226,12 @@ inline void Body::writeLabel(std::ofstream &outputFile, THREAD_ID threadID)
  * @param outputFile 
  * @param numThreads 
  */
-inline void Body::insertBarrier(std::ofstream &outputFile, UINT_32 numThreads)
+inline void Body::insertBarrier(std::ostream &outputFile, UINT_32 numThreads)
 {
-   outputFile << "   sesc_barrier(&" << "paramBarr" << ", " << numThreads << ");\n";
+   if(runtime == RuntimePthread)
+      outputFile << "   param_barrier(&" << "paramBarr" << ", " << numThreads << ");\n";
+   else
+      outputFile << "   sesc_barrier(&" << "paramBarr" << ", " << numThreads << ");\n";
    outputFile << std::endl;
 }
 
@@ -763,15 +1241,23 @@ inline void Body::insertBarrier(std::ofstream &outputFile, UINT_32 numThreads)
  * @param outputFile 
  * @param numThreads 
  */
-inline void Body::insertWait(std::ofstream &outputFile, UINT_32 numThreads)
+inline void Body::insertWait(std::ostream &outputFile, UINT_32 numThreads)
 {
    outputFile << "\n";
-   for(UINT_32 counter = 0; counter < numThreads; counter++)
+   if(runtime == RuntimePthread)
    {
-      outputFile << "   sesc_wait();\n";
+      for(UINT_32 counter = 1; counter < numThreads; counter++)
+         outputFile << "   pthread_join(paramThread[" << counter << "], NULL);\n";
    }
-   outputFile << std::endl;
-
+   else
+   {
+      for(UINT_32 counter = 0; counter < numThreads; counter++)
+      {
+         outputFile << "   sesc_wait();\n";
+      }
+   }
+   outputFile << std::endl;
+
 }
 
 /**
@@ -780,9 +1266,27 @@ inline void Body::insertWait(std::ofstream &outputFile, UINT_32 numThreads)
  * @param outputFile 
  * @param transID 
  */
-inline void Body::startTransSection(std::ofstream &outputFile, TX_ID transID)
+inline void Body::startTransSection(std::ostream &outputFile, TX_ID transID)
 {
-   outputFile << "   BEGIN_TRANSACTION(" << std:: hex << transID << ");\n" << std::dec;
+   //striped sections are timed from their first lock, written at the commit
+   if(txLatency == 1 && txMode != TxStripedLock)
+      outputFile << "   PARAM_LATENCY_BEGIN();\n";
+
+   if(txMode == TxItm)
+      outputFile << "   __transaction_atomic {\n";
+   else if(txMode == TxGlobalLock)
+      outputFile << "   GLOBAL_LOCK();\n";
+   else if(txMode == TxSpinLock)
+      outputFile << "   SPIN_LOCK();\n";
+   else if(txMode == TxStripedLock)
+   {
+      //the section is buffered until the commit, when its shared offsets are known
+      bufferingTx = 1;
+      txStripes.clear();
+      txBuffer.str("");
+   }
+   else
+      outputFile << "   BEGIN_TRANSACTION(" << std:: hex << transID << ");\n" << std::dec;
 }
 
 /**
@@ -790,21 +1294,120 @@ inline void Body::startTransSection(std::ofstream &outputFile, TX_ID transID)
  *
  * @param outputFile 
  * @param transID 
+ *
+ * Striped sections take their locks in ascending order so that two sections can never wait on each other.
  */
-inline void Body::endTransSection(std::ofstream &outputFile, TX_ID transID)
+inline void Body::endTransSection(std::ostream &outputFile, TX_ID transID)
 {
-   outputFile << "   COMMIT_TRANSACTION(" << std:: hex << transID << ");\n" << std::dec;
+   if(txMode == TxItm)
+      outputFile << "   }\t//end __transaction_atomic\n";
+   else if(txMode == TxGlobalLock)
+      outputFile << "   GLOBAL_UNLOCK();\n";
+   else if(txMode == TxSpinLock)
+      outputFile << "   SPIN_UNLOCK();\n";
+   else if(txMode == TxStripedLock)
+   {
+      bufferingTx = 0;
+
+      if(txLatency == 1)
+         outputFile << "   PARAM_LATENCY_BEGIN();\n";
+
+      for(std::set< UINT_32 >::const_iterator stripe_it = txStripes.begin(); stripe_it != txStripes.end(); stripe_it++)
+         outputFile << "   STRIPE_LOCK(" << *stripe_it << ");\n";
+
+      outputFile << txBuffer.str();
+
+      for(std::set< UINT_32 >::const_reverse_iterator stripe_it = txStripes.rbegin(); stripe_it != txStripes.rend(); stripe_it++)
+         outputFile << "   STRIPE_UNLOCK(" << *stripe_it << ");\n";
+   }
+   else
+      outputFile << "   COMMIT_TRANSACTION(" << std:: hex << transID << ");\n" << std::dec;
+
+   if(txLatency == 1)
+      outputFile << "   PARAM_LATENCY_END();\n";
 }
 
 /**
  * @ingroup Body
+ * @brief   Lock primitives for the lock-based transaction modes
  *
  * @param outputFile 
  */
-void Body::initCellLoopSection(std::ofstream &outputFile)
+void Body::writeLockMacros(std::ostream &outputFile)
 {
-   outputFile << "   __asm__ __volatile__ ( \"move %0, $0\"" << std::setw(33) << ": \"=r\"(cell_counter) );";
-   outputFile << "\n";
+   if(txMode == TxGlobalLock)
+   {
+      outputFile << "\n/* Global Lock */\n";
+      outputFile << "#include <pthread.h>\n";
+      writeGlobal(outputFile, "pthread_mutex_t txGlobalLock", "PTHREAD_MUTEX_INITIALIZER");
+      outputFile << "#define GLOBAL_LOCK()   pthread_mutex_lock(&txGlobalLock)\n";
+      outputFile << "#define GLOBAL_UNLOCK() pthread_mutex_unlock(&txGlobalLock)\n";
+   }
+   else if(txMode == TxSpinLock)
+   {
+      outputFile << "\n/* Spin Lock */\n";
+      writeGlobal(outputFile, "volatile int txSpinLock", "0");
+      outputFile << "#define SPIN_LOCK()   while(__sync_lock_test_and_set(&txSpinLock, 1)) while(txSpinLock)\n";
+      outputFile << "#define SPIN_UNLOCK() __sync_lock_release(&txSpinLock)\n";
+   }
+   else if(txMode == TxStripedLock)
+   {
+      //one spin lock per stripe, each on its own line so the locks do not falsely share
+      outputFile << "\n/* Striped Locks -- shared line n is guarded by stripe n % " << lockStripes << " */\n";
+      outputFile << "typedef struct { volatile int held; char pad[" << cacheLine - INT_SIZE << "]; } txStripe_t;\n";
+      writeGlobal(outputFile, "txStripe_t txStripeLock[" + Instruction::IntToString(lockStripes) + "] __attribute__((aligned(" + Instruction::IntToString(cacheLine) + ")))");
+      outputFile << "#define STRIPE_LOCK(n)   while(__sync_lock_test_and_set(&txStripeLock[n].held, 1)) while(txStripeLock[n].held)\n";
+      outputFile << "#define STRIPE_UNLOCK(n) __sync_lock_release(&txStripeLock[n].held)\n";
+   }
+}
+
+/**
+ * @ingroup Body
+ * @brief   Writes a global variable of the generated program
+ *
+ * Split output declares it extern in the shared header and saves the definition for
+ * main's file; otherwise it is defined where it is written.
+ *
+ * @param outputFile
+ * @param declaration e.g. "int* shared_memInt"
+ * @param initializer Value to define it with, if any
+ */
+void Body::writeGlobal(std::ostream &outputFile, const std::string &declaration, const std::string &initializer)
+{
+   std::string definition = declaration + (initializer.empty() ? "" : " = " + initializer) + ";\n";
+
+   if(splitOutput == 1)
+   {
+      outputFile << "extern " << declaration << ";\n";
+      globalDefinitions += definition;
+   }
+   else
+      outputFile << definition;
+}
+
+/**
+ * @ingroup Body
+ * @brief   How the written code names the thread it runs on
+ *
+ * @param threadID Thread whose stream is being written
+ * @return The thread number, or param_tid when every thread runs the same code
+ */
+std::string Body::threadIndex(THREAD_ID threadID) const
+{
+   if(sharedCode == 1)
+      return "param_tid";
+
+   return Instruction::IntToString(threadID);
+}
+
+/**
+ * @ingroup Body
+ *
+ * @param outputFile 
+ */
+void Body::initCellLoopSection(std::ostream &outputFile)
+{
+   backend->writeCounterReset(outputFile, "cell_counter", 0);
 }
 
 /**
@@ -813,11 +1416,9 @@ void Body::initCellLoopSection(std::ofstream &outputFile)
  * @param outputFile 
  * @param threadID 
  */
-void Body::beginCellLoopSection(std::ofstream &outputFile, THREAD_ID threadID)
+void Body::beginCellLoopSection(std::ostream &outputFile, THREAD_ID threadID)
 {
-   outputFile << "   __asm__ __volatile__ (\"";
-   outputFile << "LOOP_START_" + Instruction::IntToString(threadID) + "_" + Instruction::IntToString(basicBlockLabel) + "_:\");";
-   outputFile << "\n";
+   backend->writeLabel(outputFile, "LOOP_START_" + Instruction::IntToString(threadID) + "_" + Instruction::IntToString(basicBlockLabel) + "_");
 }
 
 /**
@@ -827,13 +1428,39 @@ void Body::beginCellLoopSection(std::ofstream &outputFile, THREAD_ID threadID)
  * @param threadID 
  * @param iterations 
  */
-void Body::endCellLoopSection(std::ofstream &outputFile, THREAD_ID threadID, UINT_32 iterations)
+void Body::endCellLoopSection(std::ostream &outputFile, THREAD_ID threadID, UINT_32 iterations)
+{
+   backend->writeLoopBranch(outputFile, "cell_counter", iterations, "LOOP_START_" + Instruction::IntToString(threadID) + "_" + Instruction::IntToString(basicBlockLabel) + "_");
+}
+
+/**
+ * @ingroup Body
+ *
+ * @param outputFile 
+ * @param extraIterations Iterations added to the first pass of the inner loop
+ */
+void Body::initNestedCellLoopSection(std::ostream &outputFile, UINT_32 extraIterations)
+{
+   backend->writeCounterReset(outputFile, "nest_counter", 0);
+   backend->writeCounterReset(outputFile, "cell_counter", -INT_32(extraIterations));
+}
+
+/**
+ * @ingroup Body
+ * 
+ * @param outputFile 
+ * @param threadID 
+ * @param iterations Inner trip count
+ * @param outerIterations Number of passes through the inner loop
+ *
+ * Closes the inner loop, then resets its counter and branches back to the same label for each outer pass.
+ */
+void Body::endNestedCellLoopSection(std::ostream &outputFile, THREAD_ID threadID, UINT_32 iterations, UINT_32 outerIterations)
 {
-   outputFile << "   __asm__ __volatile__ ( \"addi %0, %1, 1\"" << std::setw(50) << ": \"=r\"(cell_counter) :\"r\"(cell_counter) );\n";
-   outputFile << "   __asm__ __volatile__ ( \"slti %0, %1, " << iterations << "\"" << std::setw(46) << ": \"=r\"(r_out_t0) :\"r\"(cell_counter) );\n";
-   outputFile << "   __asm__ __volatile__ ( \"bne  %0, $0, ";
-   outputFile << "LOOP_START_" + Instruction::IntToString(threadID) + "_" + Instruction::IntToString(basicBlockLabel) + "_";
-   outputFile << "\" : :\"r\"(r_out_t0) );\n";
+   endCellLoopSection(outputFile, threadID, iterations);
+
+   backend->writeCounterReset(outputFile, "cell_counter", 0);
+   backend->writeLoopBranch(outputFile, "nest_counter", outerIterations, "LOOP_START_" + Instruction::IntToString(threadID) + "_" + Instruction::IntToString(basicBlockLabel) + "_");
 }
 
 /**
@@ -843,11 +1470,9 @@ void Body::endCellLoopSection(std::ofstream &outputFile, THREAD_ID threadID, UIN
  * @param threadID 
  * @param loopID 
  */
-void Body::beginMultiCellLoopSection(std::ofstream &outputFile, THREAD_ID threadID, UINT_32 loopID)
+void Body::beginMultiCellLoopSection(std::ostream &outputFile, THREAD_ID threadID, UINT_32 loopID)
 {
-   outputFile << "   __asm__ __volatile__ (\"";
-   outputFile << "LOOP_START_" + Instruction::IntToString(threadID) + "_" + Instruction::IntToString(loopID) + "_" + Instruction::IntToString(basicBlockLabel) + "_:\");";
-   outputFile << "\n";
+   backend->writeLabel(outputFile, "LOOP_START_" + Instruction::IntToString(threadID) + "_" + Instruction::IntToString(loopID) + "_" + Instruction::IntToString(basicBlockLabel) + "_");
 }
 
 /**
@@ -858,13 +1483,9 @@ void Body::beginMultiCellLoopSection(std::ofstream &outputFile, THREAD_ID thread
  * @param loopID 
  * @param iterations 
  */
-void Body::endMultiCellLoopSection(std::ofstream &outputFile, THREAD_ID threadID, UINT_32 loopID, UINT_32 iterations)
+void Body::endMultiCellLoopSection(std::ostream &outputFile, THREAD_ID threadID, UINT_32 loopID, UINT_32 iterations)
 {
-   outputFile << "   __asm__ __volatile__ ( \"addi %0, %1, 1\"" << std::setw(50) << ": \"=r\"(cell_counter) :\"r\"(cell_counter) );\n";
-   outputFile << "   __asm__ __volatile__ ( \"slti %0, %1, " << iterations << "\"" << std::setw(46) << ": \"=r\"(r_out_t0) :\"r\"(cell_counter) );\n";
-   outputFile << "   __asm__ __volatile__ ( \"bne  %0, $0, ";
-   outputFile << "LOOP_START_" + Instruction::IntToString(threadID) + "_" + Instruction::IntToString(loopID) + "_" + Instruction::IntToString(basicBlockLabel) + "_";
-   outputFile << "\" : :\"r\"(r_out_t0) );\n";
+   backend->writeLoopBranch(outputFile, "cell_counter", iterations, "LOOP_START_" + Instruction::IntToString(threadID) + "_" + Instruction::IntToString(loopID) + "_" + Instruction::IntToString(basicBlockLabel) + "_");
 }
 
 
@@ -875,14 +1496,11 @@ void Body::endMultiCellLoopSection(std::ofstream &outputFile, THREAD_ID threadID
  * @param threadID 
  * @param loopID 
  */
-void Body::beginBlockLoopSection(std::ofstream &outputFile, THREAD_ID threadID, UINT_32 loopID)
+void Body::beginBlockLoopSection(std::ostream &outputFile, THREAD_ID threadID, UINT_32 loopID)
 {
-   outputFile << "   __asm__ __volatile__ ( \"move %0, $0\"" << std::setw(34) << ": \"=r\"(block_counter) );";
+   backend->writeCounterReset(outputFile, "block_counter", 0);
+   backend->writeLabel(outputFile, "BLOCK_START_" + Instruction::IntToString(threadID) + "_" + Instruction::IntToString(loopID) + "_");
    outputFile << "\n";
-
-   outputFile << "   __asm__ __volatile__ (\"";
-   outputFile << "BLOCK_START_" + Instruction::IntToString(threadID) + "_" + Instruction::IntToString(loopID) + "_:\");";
-   outputFile << "\n\n";
 }
 
 
@@ -894,13 +1512,9 @@ void Body::beginBlockLoopSection(std::ofstream &outputFile, THREAD_ID threadID,
  * @param loopID 
  * @param iterations 
  */
-void Body::endBlockLoopSection(std::ofstream &outputFile, THREAD_ID threadID, UINT_32 loopID, UINT_32 iterations)
+void Body::endBlockLoopSection(std::ostream &outputFile, THREAD_ID threadID, UINT_32 loopID, UINT_32 iterations)
 {
-   outputFile << "   __asm__ __volatile__ ( \"addi %0, %1, 1\"" << std::setw(52) << ": \"=r\"(block_counter) :\"r\"(block_counter) );\n";
-   outputFile << "   __asm__ __volatile__ ( \"slti %0, %1, " << iterations << "\"" << std::setw(47) << ": \"=r\"(r_out_t0) :\"r\"(block_counter) );\n";
-   outputFile << "   __asm__ __volatile__ ( \"bne  %0, $0, ";
-   outputFile << "BLOCK_START_" + Instruction::IntToString(threadID) + "_" + Instruction::IntToString(loopID) + "_";
-   outputFile << "\" : :\"r\"(r_out_t0) );\n";
+   backend->writeLoopBranch(outputFile, "block_counter", iterations, "BLOCK_START_" + Instruction::IntToString(threadID) + "_" + Instruction::IntToString(loopID) + "_");
 }
 
 
@@ -910,12 +1524,23 @@ void Body::endBlockLoopSection(std::ofstream &outputFile, THREAD_ID threadID, UI
  * @param outputFile 
  * @param threadID 
  */
-inline void Body::beginProgamIterations(std::ofstream &outputFile, THREAD_ID threadID)
+inline void Body::beginProgamIterations(std::ostream &outputFile, THREAD_ID threadID)
 {
+   if(measure == 1)
+      outputFile << "   PARAM_THREAD_START(" << threadIndex(threadID) << ");\n";
+
    outputFile << "   for(counter = 0; counter < " << "LOOP_" << threadID << "; counter++)";
    outputFile << "\n";
    outputFile << "   {";
    outputFile << "\n";
+   backend->writeIterationSetup(outputFile);
+
+   //every thread's iteration n works in the same shared window, so conflicts line up as before
+   if(workingSetWindows > 1)
+      outputFile << "   s_window = s_data_out_int_base + (counter % " << workingSetWindows << ") * " << WS_WINDOW << ";\n";
+
+   if(measure == 1)
+      outputFile << "   unsigned long long iterationStart = param_now();\n";
 // outputFile << "   fprintf(stderr, \"Thread " << threadID << " iteration %d\\n\", counter);\n";
 // outputFile << "   fflush(stderr);\n";
 }
@@ -924,12 +1549,22 @@ inline void Body::beginProgamIterations(std::ofstream &outputFile, THREAD_ID thr
  * @ingroup Body
  * 
  * @param outputFile 
+ * @param threadID 
  */
-inline void Body::endProgamIterations(std::ofstream &outputFile)
+inline void Body::endProgamIterations(std::ostream &outputFile, THREAD_ID threadID)
 {
+   if(measure == 1)
+      outputFile << "   param_iteration(&paramStats[" << threadIndex(threadID) << "], iterationStart);\n";
+
    outputFile << "   }";
    outputFile << "\t//end LOOP";
    outputFile << "\n";
+
+   if(measure == 1)
+      outputFile << "   PARAM_THREAD_END(" << threadIndex(threadID) << ");\n";
+
+   if(txLatency == 1)
+      outputFile << "   param_latency_flush();\n";
 }
 
 /**
@@ -937,11 +1572,11 @@ inline void Body::endProgamIterations(std::ofstream &outputFile)
  *
  * @param outputFile 
 **/
-void Body::headerGen(std::ofstream &outputFile)
+void Body::headerGen(std::ostream &outputFile)
 {
    /* Variables */
    UINT_32 maxInstructions = 0;
-   UINT_32 memSize = MEM_REGION;
+   UINT_64 memSize = regionSize();
 
    /* Processes */
    outputFile << "//  This file was automatically generated.\n//  Do not edit this file.\n//\n//\n";
@@ -950,10 +1585,132 @@ void Body::headerGen(std::ofstream &outputFile)
    outputFile << "/// @author Clay Hughes, James Poe, and Tao Li\n";
    outputFile << "//\n// Copyright: See COPYING file that comes with this distribution\n//\n///////////////////////////////////////////////////////////////////////////////////\n";
 
+   string rootName = config->read<string>("Global", "fileName");
+   if(splitOutput == 1)
+   {
+      outputFile << "#include \"" << rootName << ".h\"\n\n";
+      outputFile << "/* Globals declared in " << rootName << ".h */\n";
+      outputFile << globalDefinitions;
+   }
+   else
+   {
+      sharedHeaderGen(outputFile);
+
+      //includes for thread header files
+      if(sharedCode == 1)
+         outputFile << "#include \"" << rootName << "_shared.h\"\n";
+      for(UINT_32 threadCounter = 1; threadCounter < codeThreads; threadCounter++)
+      {
+         outputFile << "#include \"" << rootName << "_" << threadCounter << ".h\"";
+         outputFile << "\n";
+      }
+   }
+
+   outputFile << "\n\nint main()\n{\n";							// --- main
+
+   //with shared code thread 0 runs in threadFunc, which sets up its own registers and region
+   if(sharedCode == 0)
+   {
+      backend->writeRegisters(outputFile);
+      backend->writeChaseRegisters(outputFile, chaseChains);
+      if(condBranches == 1)
+         outputFile << "   unsigned int branch_index = 0;\n   int branch_bit;\n";
+
+      outputFile << "\n   /* Set Loop */\n";
+      outputFile << "   unsigned int counter;\n";
+
+      outputFile << "\n   /* Initialize Private Memory Region */\n";
+      outputFile << "   int* memInt;\n";
+//       outputFile << "   float* memFloat;\n";
+      outputFile << "   " << backend->get_addressType() << " data_out_int_base;\n";
+      if(workingSetWindows > 1)
+         outputFile << "   " << backend->get_addressType() << " s_window;\n";
+      if(falseSharing > 0.0)
+         outputFile << "   " << backend->get_addressType() << " fs_data_out_tid;\n";
+//       outputFile << "   int data_out_float_base;\n";
+
+      outputFile << "\n";
+      outputFile << "   memInt           = " << allocCall(memSize, prefault || firstTouch) << ";\n";
+      outputFile << "   data_out_int     = (" << backend->get_addressType() << ")&(memInt[0]);\n";
+//       outputFile << "   memFloat         = (float*)malloc(sizeof(float) * " << memSize << ");\n";
+//       outputFile << "   data_out_float   = (int)&(memFloat[0]);\n";
+   }
+
+   outputFile << "\n";
+   outputFile << "   shared_memInt    = " << allocCall(memSize, prefault) << ";\n";
+   outputFile << "   s_data_out_int   = (" << backend->get_addressType() << ")&(shared_memInt[0]);\n";
+
+   if(falseSharing > 0.0)
+   {
+      outputFile << "   false_memInt     = " << allocCall(memSize * falseSharingCopies(), prefault) << ";\n";
+      outputFile << "   fs_data_out_int  = (" << backend->get_addressType() << ")&(false_memInt[0]);\n";
+      if(sharedCode == 0)
+         outputFile << "   fs_data_out_tid  = fs_data_out_int;\n";
+   }
+//    outputFile << "   shared_memFloat  = (float*)malloc(sizeof(float) * " << memSize << ");\n";
+//    outputFile << "   s_data_out_float = (int)&(shared_memFloat[0]);\n";
+
+   outputFile << "\n";
+   outputFile << "   s_data_out_int_base = s_data_out_int;\n";
+//    outputFile << "   s_data_out_float_base = s_data_out_float;\n";
+   if(sharedCode == 0)
+      outputFile << "   data_out_int_base = data_out_int;\n";
+//    outputFile << "   data_out_float_base = data_out_float;\n";
+   outputFile << "\n";
+
+   if(chaseChains > 0)
+   {
+      outputFile << "   chase_memInt     = " << allocCall(memSize, prefault) << ";\n";
+      outputFile << "   chase_data       = (" << backend->get_addressType() << ")&(chase_memInt[0]);\n";
+      outputFile << "   param_chase_init(" << memSize * INT_SIZE / cacheLine << "UL, " << cacheLine << ");\n";
+      if(sharedCode == 0)
+         chaseStartGen(0, outputFile);
+      outputFile << "\n";
+   }
+
+   if(condBranches == 1)
+   {
+      branchInitGen(outputFile);
+      outputFile << "\n";
+   }
+
+   //thread spawns
+   outputFile << "   //spawn threads\n";
+   for(UINT_32 threadCounter = 1; threadCounter < numThreads; threadCounter++)
+   {
+      if(sharedCode == 1 && runtime == RuntimePthread)
+         outputFile << "   pthread_create(&paramThread[" << threadCounter << "], NULL, threadFunc, (void*)" << threadCounter << ");";
+      else if(sharedCode == 1)
+         outputFile << "   sesc_spawn(threadFunc, (void*)" << threadCounter << ", 0);";
+      else if(runtime == RuntimePthread)
+         outputFile << "   pthread_create(&paramThread[" << threadCounter << "], NULL, threadFunc" << threadCounter << ", NULL);";
+      else
+         outputFile << "   sesc_spawn(threadFunc" << threadCounter << ", NULL, 0);";
+      outputFile << "\n";
+   }
+
+   outputFile << std::endl;
+
+}
+
+/**
+ * @ingroup Body
+ * @brief   Includes, macros, helpers and globals every part of the program sees
+ *
+ * @param outputFile
+ */
+void Body::sharedHeaderGen(std::ostream &outputFile)
+{
    outputFile << "#include <stdio.h>\n";
    outputFile << "#include <stdint.h>\n";
    outputFile << "#include <stdlib.h>\n";
-   outputFile << "#include \"sescapi.h\"\n\n";
+   if(runtime == RuntimePthread)
+      outputFile << "#include \"param_runtime.h\"\n\n";
+   else
+      outputFile << "#include \"sescapi.h\"\n\n";
+
+   if(txMode == TxItm)
+      outputFile << "//  Transactions use GCC's software TM -- build with: gcc -O0 -fgnu-tm ... -litm\n\n";
 
    for(UINT_32 threadCounter = 0; threadCounter < numThreads; threadCounter++)
    {
@@ -966,103 +1723,167 @@ void Body::headerGen(std::ofstream &outputFile)
    }
    outputFile << "\n";
 
-   outputFile << "#define BEGIN_TRANSACTION(n) do {\t\t\t\\\n";
-   outputFile << "        __asm__ __volatile__ (\".word 0x70000000+\" #n);\t\\\n";
-   outputFile << "} while (0)\n\n";
+   backend->writeTransactionMacros(outputFile);
+   writeLockMacros(outputFile);
+
+   if(hugePages == 1 || prefault == 1 || firstTouch == 1)
+      allocatorGen(outputFile);
 
-   outputFile << "#define COMMIT_TRANSACTION(n) do {\t\t\t\\\n";
-   outputFile << "        __asm__ __volatile__ (\".word 0x7C000000+\" #n);\t\\\n";
-   outputFile << "} while (0)\n";
+   if(measure == 1)
+      harnessGen(outputFile);
+
+   if(txLatency == 1)
+      latencyGen(outputFile);
 
    outputFile << "\n/* Set Barrier */\n";
-   outputFile << "sbarrier_t paramBarr;\n";
+   if(runtime == RuntimePthread)
+   {
+      writeGlobal(outputFile, "param_barrier_t paramBarr");
+      writeGlobal(outputFile, "pthread_t paramThread[" + Instruction::IntToString(numThreads) + "]");
+   }
+   else
+      writeGlobal(outputFile, "sbarrier_t paramBarr");
 
    outputFile << "\n/* Initialize Shared Memory Region */\n";
-   outputFile << "int* shared_memInt;\n";
-   outputFile << "register int s_data_out_int asm(\"22\");\n";
-//    outputFile << "float* shared_memFloat;\n";
-//    outputFile << "register int s_data_out_float asm(\"23\");\n";
+   writeGlobal(outputFile, "int* shared_memInt");
+   if(splitOutput == 1 && backend->get_sharedBaseInRegister() == 0)
+   {
+      std::ostringstream sharedBase;
+
+      backend->writeSharedBase(sharedBase);
+      writeGlobal(outputFile, sharedBase.str().substr(0, sharedBase.str().find(';')));
+   }
+   else
+      backend->writeSharedBase(outputFile);
    outputFile << "\n";
 
-   outputFile << "int s_data_out_int_base;\n";
-//    outputFile << "int s_data_out_float_base;\n\n";
+   writeGlobal(outputFile, backend->get_addressType() + " s_data_out_int_base");
 
-   //includes for thread header files
-   string rootName = config->read<string>("Global", "fileName");
-   for(UINT_32 threadCounter = 1; threadCounter < numThreads; threadCounter++)
+   if(falseSharing > 0.0)
    {
-      outputFile << "#include \"" << rootName << "_" << threadCounter << ".h\"";
-      outputFile << "\n";
+      outputFile << "\n/* False-Sharing Region -- thread t owns word t % " << cacheLine / INT_SIZE << " of each line in copy t / " << cacheLine / INT_SIZE << " */\n";
+      writeGlobal(outputFile, "int* false_memInt");
+      writeGlobal(outputFile, backend->get_addressType() + " fs_data_out_int");
    }
+//    outputFile << "int s_data_out_float_base;\n\n";
 
-   outputFile << "\n\nint main()\n{\n";							// --- main
+   if(chaseChains > 0)
+      chaseGen(outputFile);
 
-   outputFile << "   register int r_out_t0 asm(\"8\");\n";
-   outputFile << "   register int r_out_t1 asm(\"9\");\n";
-   outputFile << "   register int r_out_t2 asm(\"10\");\n";
-   outputFile << "   register int r_out_t3 asm(\"11\");\n";
-   outputFile << "   register int r_out_t4 asm(\"12\");\n";
-   outputFile << "   register int r_out_t5 asm(\"13\");\n";
-
-   outputFile << "   register int r_out_s0 asm(\"16\");\n";
-   outputFile << "   register int r_out_s1 asm(\"17\");\n";
-   outputFile << "   register int r_out_s2 asm(\"18\");\n";
-   outputFile << "   register int r_out_s3 asm(\"19\");\n";
-   outputFile << "   register int r_out_s4 asm(\"20\");\n";
-   outputFile << "   register int r_out_s5 asm(\"21\");\n";
-
-   outputFile << "   register int r_out_f2 asm(\"$f2\");\n";
-   outputFile << "   register int r_out_f4 asm(\"$f4\");\n";
-   outputFile << "   register int r_out_f6 asm(\"$f6\");\n";
-   outputFile << "   register int r_out_f8 asm(\"$f8\");\n";
-   outputFile << "   register int r_out_f10 asm(\"$f10\");\n";
-   outputFile << "   register int r_out_f12 asm(\"$f12\");\n";
-
-   outputFile << "\n   register int data_out_int asm(\"20\");\n";
-   outputFile << "   register int data_out_float asm(\"21\");\n";
+   if(condBranches == 1)
+      branchGen(outputFile);
+}
 
-   outputFile << "\n   /* Set Loop */\n";
-   outputFile << "   unsigned int counter;\n";
+/**
+ * @ingroup Body
+ * @brief   Header shared by the translation units of a split program
+ *
+ * Globals are declared extern here (see writeGlobal) and the thread functions are
+ * prototyped so main can spawn them.
+ *
+ * @param outputFile
+ */
+void Body::splitHeaderGen(std::ostream &outputFile)
+{
+   /* Variables */
+   string rootName = config->read<string>("Global", "fileName");
 
-   outputFile << "\n   /* Initialize Private Memory Region */\n";
-   outputFile << "   int* memInt;\n";
-//    outputFile << "   float* memFloat;\n";
-   outputFile << "   int data_out_int_base;\n";
-//    outputFile << "   int data_out_float_base;\n";
+   /* Processes */
+   outputFile << "//  This file was automatically generated.\n//  Do not edit this file.\n//\n//\n";
+   outputFile << "/// @file param_prog.h\n";
+   outputFile << "/// @author IDEAL Lab, University of Florida\n";
+   outputFile << "/// @author Clay Hughes, James Poe, and Tao Li\n";
+   outputFile << "//\n// Copyright: See COPYING file that comes with this distribution\n//\n///////////////////////////////////////////////////////////////////////////////////\n";
 
-   //loop counters
-   outputFile << "   register int cell_counter asm(\"23\");\t\t//inner loop counter\n";
-   outputFile << "   register int block_counter asm(\"14\");\t\t//outer loop counter\n";
+   outputFile << "#ifndef PARAM_PROG_H\n#define PARAM_PROG_H\n\n";
 
-   outputFile << "\n";
-   outputFile << "   memInt           = (int*)malloc(sizeof(int) * " << memSize << ");\n";
-   outputFile << "   data_out_int     = (int)&(memInt[0]);\n";
-//    outputFile << "   memFloat         = (float*)malloc(sizeof(float) * " << memSize << ");\n";
-//    outputFile << "   data_out_float   = (int)&(memFloat[0]);\n";
+   sharedHeaderGen(outputFile);
 
-   outputFile << "\n";
-   outputFile << "   shared_memInt    = (int*)malloc(sizeof(int) * " << memSize << ");\n";
-   outputFile << "   s_data_out_int   = (int)&(shared_memInt[0]);\n";
-//    outputFile << "   shared_memFloat  = (float*)malloc(sizeof(float) * " << memSize << ");\n";
-//    outputFile << "   s_data_out_float = (int)&(shared_memFloat[0]);\n";
+   outputFile << "\n/* Thread Functions */\n";
+   if(sharedCode == 1 && runtime == RuntimePthread)
+      outputFile << "void *threadFunc(void *ptr);\n";
+   else if(sharedCode == 1)
+      outputFile << "void threadFunc(void *ptr);\n";
+   for(UINT_32 threadCounter = 1; threadCounter < codeThreads; threadCounter++)
+   {
+      if(runtime == RuntimePthread)
+         outputFile << "void *threadFunc" << threadCounter << "(void *ptr);\n";
+      else
+         outputFile << "void threadFunc" << threadCounter << "(void *ptr);\n";
+   }
 
-   outputFile << "\n";
-   outputFile << "   s_data_out_int_base = s_data_out_int;\n";
-//    outputFile << "   s_data_out_float_base = s_data_out_float;\n";
-   outputFile << "   data_out_int_base = data_out_int;\n";
-//    outputFile << "   data_out_float_base = data_out_float;\n";
-   outputFile << "\n";
+   outputFile << "\n#endif\n";
+}
 
-   //thread spawns
-   outputFile << "   //spawn threads\n";
-   for(UINT_32 threadCounter = 1; threadCounter < numThreads; threadCounter++)
+/**
+ * @ingroup Body
+ * @brief   Build rules for a split program
+ *
+ * Each program gets <name>.mk with its objects and flags; the Makefile next to it includes
+ * every .mk in the directory, so one make -j builds all of them in parallel.
+ *
+ * @param outputDir Directory the program is written to
+ */
+void Body::makefileGen(const std::string &outputDir)
+{
+   /* Variables */
+   string rootName = config->read<string>("Global", "fileName");
+   string cflags = (backend->get_name() == "c") ? "-O0" : "-O2";
+   string libs;
+   string objects = rootName + ".o";
+
+   /* Processes */
+   if(runtime == RuntimePthread || txMode == TxGlobalLock)
    {
-      outputFile << "   sesc_spawn(threadFunc" << threadCounter << ", NULL, 0);";
-      outputFile << "\n";
+      cflags += " -pthread";
+      libs += " -pthread";
+   }
+   if(txMode == TxItm)
+   {
+      cflags += " -fgnu-tm";
+      libs += " -litm";
    }
 
-   outputFile << std::endl;
-
+   if(sharedCode == 1)
+      objects += " " + rootName + "_shared.o";
+   for(UINT_32 threadCounter = 1; threadCounter < codeThreads; threadCounter++)
+      objects += " " + rootName + "_" + Instruction::IntToString(threadCounter) + ".o";
+
+   std::ofstream rulesFile((outputDir + rootName + ".mk").c_str(), std::ios::trunc);
+   if(!rulesFile)
+      std::cerr << "Error opening file.\n";
+
+   rulesFile << "#  This file was automatically generated.\n#  Do not edit this file.\n\n";
+   if(backend->get_name() == "mips")
+      rulesFile << "#  MIPS output -- run make with CC set to the SESC cross compiler\n\n";
+
+   rulesFile << rootName << "_CFLAGS := " << cflags << "\n";
+   rulesFile << rootName << "_LIBS   :=" << libs << "\n";
+   rulesFile << rootName << "_OBJS   := " << objects << "\n\n";
+
+   rulesFile << "PROGRAMS += " << rootName << ".bin\n";
+   rulesFile << "OBJECTS  += $(" << rootName << "_OBJS)\n\n";
+
+   rulesFile << rootName << ".bin : $(" << rootName << "_OBJS)\n";
+   rulesFile << "\t$(CC) $(" << rootName << "_CFLAGS) $(CFLAGS) -o $@ $^ $(" << rootName << "_LIBS) $(LDLIBS)\n\n";
+
+   rulesFile << "$(" << rootName << "_OBJS) : %.o : %.c " << rootName << ".h\n";
+   rulesFile << "\t$(CC) $(" << rootName << "_CFLAGS) $(CFLAGS) -c -o $@ $<\n";
+   rulesFile.close();
+
+   std::ofstream makeFile((outputDir + "Makefile").c_str(), std::ios::trunc);
+   if(!makeFile)
+      std::cerr << "Error opening file.\n";
+
+   makeFile << "#  This file was automatically generated.\n#  Do not edit this file.\n";
+   makeFile << "#  Builds every split program in this directory -- make -j builds their parts in parallel.\n\n";
+   makeFile << ".DEFAULT_GOAL := all\n\n";
+   makeFile << "PROGRAMS :=\nOBJECTS  :=\n\n";
+   makeFile << "include $(wildcard *.mk)\n\n";
+   makeFile << "all : $(PROGRAMS)\n\n";
+   makeFile << "clean :\n\trm -f $(PROGRAMS) $(OBJECTS)\n\n";
+   makeFile << ".PHONY : all clean\n";
+   makeFile.close();
 }
 
 /**
@@ -1070,11 +1891,16 @@ void Body::headerGen(std::ofstream &outputFile)
  *
  * @param outputFile 
  */
-void Body::trailerGen(std::ofstream &outputFile)
+void Body::trailerGen(std::ostream &outputFile)
 {
    /* Variables */
 
    /* Processes */
+   if(measure == 1)
+      outputFile << "   param_report(" << numThreads << ");\n";
+   if(txLatency == 1)
+      outputFile << "   param_latency_report();\n";
+
    outputFile << "\n   return 0;\n}\n";
 }
 
@@ -1085,48 +1911,42 @@ void Body::trailerGen(std::ofstream &outputFile)
  * @param threadID 
  * @param outputFile 
  */
-void Body::funcHeaderGen(THREAD_ID threadID, std::ofstream &outputFile)
+void Body::funcHeaderGen(THREAD_ID threadID, std::ostream &outputFile)
 {
    /* Variables */
-   UINT_32 memSize = MEM_REGION;
+   UINT_64 memSize = regionSize();
 
    /* Processes */
    outputFile << "//  This file was automatically generated.\n//  Do not edit this file.\n//\n//\n";
-   outputFile << "/// @file param_prog" << "_" << threadID << ".h\n";
+   if(sharedCode == 1)
+      outputFile << "/// @file param_prog_shared" << (splitOutput == 1 ? ".c\n" : ".h\n");
+   else
+      outputFile << "/// @file param_prog" << "_" << threadID << (splitOutput == 1 ? ".c\n" : ".h\n");
    outputFile << "/// @author IDEAL Lab, University of Florida\n";
    outputFile << "/// @author Clay Hughes, James Poe, and Tao Li\n";
    outputFile << "//\n// Copyright: See COPYING file that comes with this distribution\n//\n///////////////////////////////////////////////////////////////////////////////////\n";
 
-   outputFile << "\n\nvoid threadFunc" << Instruction::IntToString(threadID) << "(void *ptr)\n";
+   if(splitOutput == 1)
+      outputFile << "#include \"" << config->read<string>("Global", "fileName") << ".h\"\n";
+
+   //one copy of the code, so its asm labels must not be duplicated by inlining or cloning
+   if(sharedCode == 1 && runtime == RuntimePthread)
+      outputFile << "\n\n__attribute__((noinline, noclone)) void *threadFunc(void *ptr)\n";
+   else if(sharedCode == 1)
+      outputFile << "\n\n__attribute__((noinline, noclone)) void threadFunc(void *ptr)\n";
+   else if(runtime == RuntimePthread)
+      outputFile << "\n\nvoid *threadFunc" << Instruction::IntToString(threadID) << "(void *ptr)\n";
+   else
+      outputFile << "\n\nvoid threadFunc" << Instruction::IntToString(threadID) << "(void *ptr)\n";
    outputFile << "{\n";
 
-   outputFile << "   register int r_out_t0 asm(\"8\");\n";
-   outputFile << "   register int r_out_t1 asm(\"9\");\n";
-   outputFile << "   register int r_out_t2 asm(\"10\");\n";
-   outputFile << "   register int r_out_t3 asm(\"11\");\n";
-   outputFile << "   register int r_out_t4 asm(\"12\");\n";
-   outputFile << "   register int r_out_t5 asm(\"13\");\n";
-
-   outputFile << "   register int r_out_s0 asm(\"16\");\n";
-   outputFile << "   register int r_out_s1 asm(\"17\");\n";
-   outputFile << "   register int r_out_s2 asm(\"18\");\n";
-   outputFile << "   register int r_out_s3 asm(\"19\");\n";
-   outputFile << "   register int r_out_s4 asm(\"20\");\n";
-   outputFile << "   register int r_out_s5 asm(\"21\");\n";
-
-   outputFile << "   register int r_out_f2 asm(\"$f2\");\n";
-   outputFile << "   register int r_out_f4 asm(\"$f4\");\n";
-   outputFile << "   register int r_out_f6 asm(\"$f6\");\n";
-   outputFile << "   register int r_out_f8 asm(\"$f8\");\n";
-   outputFile << "   register int r_out_f10 asm(\"$f10\");\n";
-   outputFile << "   register int r_out_f12 asm(\"$f12\");\n";
-
-   outputFile << "\n   register int data_out_int asm(\"20\");\n";
-   outputFile << "   register int data_out_float asm(\"21\");\n";
-
-   //loop counters
-   outputFile << "   register int cell_counter asm(\"23\");\t\t//inner loop counter\n";
-   outputFile << "   register int block_counter asm(\"14\");\t\t//outer loop counter\n";
+   if(sharedCode == 1)
+      outputFile << "   unsigned int param_tid = (unsigned int)(uintptr_t)ptr;\n\n";
+
+   backend->writeRegisters(outputFile);
+   backend->writeChaseRegisters(outputFile, chaseChains);
+   if(condBranches == 1)
+      outputFile << "   unsigned int branch_index = 0;\n   int branch_bit;\n";
 
    outputFile << "\n   /* Set Loop */\n";
    outputFile << "   unsigned int counter;\n";
@@ -1136,15 +1956,31 @@ void Body::funcHeaderGen(THREAD_ID threadID, std::ofstream &outputFile)
 //    outputFile << "   float* memFloat;\n";
 
    outputFile << "\n";
-   outputFile << "   memInt         = (int*)malloc(sizeof(int) * " << memSize << ");\n";
-   outputFile << "   data_out_int   = (int)&(memInt[0]);\n";
+   outputFile << "   memInt         = " << allocCall(memSize, prefault || firstTouch) << ";\n";
+   outputFile << "   data_out_int   = (" << backend->get_addressType() << ")&(memInt[0]);\n";
 //    outputFile << "   memFloat       = (float*)malloc(sizeof(float) * " << memSize << ");\n";
 //    outputFile << "   data_out_float = (int)&(memFloat[0]);\n";
 
    outputFile << "\n";
-   outputFile << "   int data_out_int_base = data_out_int;\n";
+   outputFile << "   " << backend->get_addressType() << " data_out_int_base = data_out_int;\n";
+   if(workingSetWindows > 1)
+      outputFile << "   " << backend->get_addressType() << " s_window;\n";
 //    outputFile << "   int data_out_float_base = data_out_float;\n";
 
+   //each run of cacheLine / INT_SIZE threads has its own copy of the region, so no two threads share a word;
+   //shared code was written for thread 0's word, so the base also moves to the thread's word
+   if(falseSharing > 0.0)
+   {
+      outputFile << "   " << backend->get_addressType() << " fs_data_out_tid = fs_data_out_int + ";
+      if(sharedCode == 1)
+         outputFile << "(param_tid / " << cacheLine / INT_SIZE << ") * " << memSize * INT_SIZE << " + (param_tid % " << cacheLine / INT_SIZE << ") * " << INT_SIZE << ";\n";
+      else
+         outputFile << threadID / (cacheLine / INT_SIZE) * memSize * INT_SIZE << ";\n";
+   }
+
+   if(chaseChains > 0)
+      chaseStartGen(threadID, outputFile);
+
    outputFile << std::endl;
 
 }
@@ -1156,11 +1992,475 @@ void Body::funcHeaderGen(THREAD_ID threadID, std::ofstream &outputFile)
  * @param threadID 
  * @param outputFile 
  */
-void Body::funcTrailerGen(THREAD_ID threadID, std::ofstream &outputFile)
+void Body::funcTrailerGen(THREAD_ID threadID, std::ostream &outputFile)
+{
+   /* Variables */
+
+   /* Processes */
+   outputFile << "\n";
+   if(runtime == RuntimePthread)
+      outputFile << "   return NULL;\n";
+   outputFile << "}\n";
+}
+
+/**
+ * @ingroup Body
+ * @brief   Region allocator used when page placement is requested
+ *
+ * @param outputFile 
+ *
+ * Regions come from mmap, aligned to 2MB so transparent huge pages can back them whole. A touched region
+ * has one word per page written before it is returned; private regions are allocated by the thread that
+ * uses them, so touching them there is that thread's first touch.
+ */
+void Body::allocatorGen(std::ostream &outputFile)
+{
+   /* Variables */
+
+   /* Processes */
+   outputFile << "\n/* Region Placement */\n";
+   outputFile << "#include <sys/mman.h>\n\n";
+
+   outputFile << "#define PARAM_HUGE_PAGE (2UL << 20)\n";
+   outputFile << "#define PARAM_PAGE      4096UL\n\n";
+
+   outputFile << "static int* param_alloc(size_t bytes, int touch)\n";
+   outputFile << "{\n";
+   outputFile << "   size_t length = bytes + PARAM_HUGE_PAGE;\n";
+   outputFile << "   char *region = (char*)mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);\n";
+   outputFile << "   size_t offset;\n\n";
+   outputFile << "   if(region == MAP_FAILED)\n";
+   outputFile << "   {\n";
+   outputFile << "      perror(\"mmap\");\n";
+   outputFile << "      exit(1);\n";
+   outputFile << "   }\n";
+   outputFile << "   region = (char*)(((uintptr_t)region + PARAM_HUGE_PAGE - 1) & ~(PARAM_HUGE_PAGE - 1));\n\n";
+
+   if(hugePages == 1)
+   {
+      outputFile << "#ifdef MADV_HUGEPAGE\n";
+      outputFile << "   madvise(region, bytes, MADV_HUGEPAGE);\n";
+      outputFile << "#endif\n\n";
+   }
+
+   outputFile << "   if(touch)\n";
+   outputFile << "   {\n";
+   outputFile << "      for(offset = 0; offset < bytes; offset += PARAM_PAGE)\n";
+   outputFile << "         ((volatile char*)region)[offset] = 0;\n";
+   outputFile << "   }\n\n";
+   outputFile << "   return (int*)region;\n";
+   outputFile << "}\n";
+}
+
+/**
+ * @ingroup Body
+ * @brief   Allocation expression for a region of ints
+ *
+ * @param ints Region size
+ * @param touch Whether the pages are touched before the region is used
+ * @return malloc, or param_alloc when page placement is requested
+ */
+std::string Body::allocCall(UINT_64 ints, BOOL touch) const
+{
+   std::ostringstream call;
+
+   if(hugePages == 1 || prefault == 1 || firstTouch == 1)
+      call << "param_alloc(sizeof(int) * " << ints << ", " << (touch ? 1 : 0) << ")";
+   else
+      call << "(int*)malloc(sizeof(int) * " << ints << ")";
+
+   return call.str();
+}
+
+/**
+ * @ingroup Body
+ * @brief   Copies of the false-sharing region, one per cacheLine / INT_SIZE threads
+ */
+UINT_32 Body::falseSharingCopies(void) const
+{
+   return (numThreads + cacheLine / INT_SIZE - 1) / (cacheLine / INT_SIZE);
+}
+
+/**
+ * @ingroup Body
+ * @brief   Timing and transaction counters for the measurement harness
+ *
+ * @param outputFile 
+ *
+ * Each thread owns a line-aligned slot, so the counters add no sharing of their own. At exit main prints
+ * a single JSON object with the run's throughput, the per-thread times and their imbalance (slowest
+ * thread over the mean).
+ */
+void Body::harnessGen(std::ostream &outputFile)
 {
    /* Variables */
 
    /* Processes */
+   outputFile << "\n/* Measurement Harness */\n";
+   outputFile << "#include <time.h>\n\n";
+
+   outputFile << "typedef struct\n";
+   outputFile << "{\n";
+   outputFile << "   unsigned long long start, end;\n";
+   outputFile << "   unsigned long long iterations, iterationTotal, iterationMin, iterationMax;\n";
+   outputFile << "   unsigned long long transactions;\n";
+   outputFile << "} __attribute__((aligned(64))) param_stats_t;\n\n";
+
+   writeGlobal(outputFile, "param_stats_t paramStats[" + Instruction::IntToString(numThreads) + "]");
    outputFile << "\n";
+
+   outputFile << "#define PARAM_THREAD_START(t) (paramStats[t].start = param_now(), paramStats[t].iterationMin = ~0ULL)\n";
+   outputFile << "#define PARAM_THREAD_END(t)   (paramStats[t].end = param_now())\n";
+   outputFile << "#define PARAM_TX_COMMITTED(t) (paramStats[t].transactions++)\n\n";
+
+   outputFile << "static unsigned long long param_now(void)\n";
+   outputFile << "{\n";
+   outputFile << "   struct timespec now;\n\n";
+   outputFile << "   clock_gettime(CLOCK_MONOTONIC, &now);\n";
+   outputFile << "   return now.tv_sec * 1000000000ULL + now.tv_nsec;\n";
+   outputFile << "}\n\n";
+
+   outputFile << "static void param_iteration(param_stats_t *stats, unsigned long long start)\n";
+   outputFile << "{\n";
+   outputFile << "   unsigned long long duration = param_now() - start;\n\n";
+   outputFile << "   stats->iterations++;\n";
+   outputFile << "   stats->iterationTotal += duration;\n";
+   outputFile << "   if(duration < stats->iterationMin)\n";
+   outputFile << "      stats->iterationMin = duration;\n";
+   outputFile << "   if(duration > stats->iterationMax)\n";
+   outputFile << "      stats->iterationMax = duration;\n";
+   outputFile << "}\n\n";
+
+   outputFile << "static void param_report(unsigned int numThreads)\n";
+   outputFile << "{\n";
+   outputFile << "   unsigned long long first = ~0ULL, last = 0, slowest = 0, threadTotal = 0, transactions = 0;\n";
+   outputFile << "   double elapsed, mean;\n";
+   outputFile << "   unsigned int t;\n\n";
+   outputFile << "   for(t = 0; t < numThreads; t++)\n";
+   outputFile << "   {\n";
+   outputFile << "      unsigned long long threadTime = paramStats[t].end - paramStats[t].start;\n\n";
+   outputFile << "      if(paramStats[t].start < first) first = paramStats[t].start;\n";
+   outputFile << "      if(paramStats[t].end > last) last = paramStats[t].end;\n";
+   outputFile << "      if(threadTime > slowest) slowest = threadTime;\n";
+   outputFile << "      threadTotal += threadTime;\n";
+   outputFile << "      transactions += paramStats[t].transactions;\n";
+   outputFile << "   }\n\n";
+   outputFile << "   elapsed = (last - first) / 1e9;\n";
+   outputFile << "   mean = (double)threadTotal / numThreads;\n\n";
+   outputFile << "   printf(\"{\\\"threads\\\": %u, \\\"elapsed_s\\\": %.9f, \\\"transactions\\\": %llu, \\\"tx_per_s\\\": %.1f, \\\"imbalance\\\": %.4f, \\\"per_thread\\\": [\",\n";
+   outputFile << "          numThreads, elapsed, transactions, elapsed > 0 ? transactions / elapsed : 0.0, mean > 0 ? slowest / mean : 1.0);\n";
+   outputFile << "   for(t = 0; t < numThreads; t++)\n";
+   outputFile << "   {\n";
+   outputFile << "      param_stats_t *stats = &paramStats[t];\n\n";
+   outputFile << "      printf(\"%s{\\\"thread\\\": %u, \\\"start_s\\\": %.9f, \\\"end_s\\\": %.9f, \\\"transactions\\\": %llu, \\\"iterations\\\": %llu, \",\n";
+   outputFile << "             t ? \", \" : \"\", t, (stats->start - first) / 1e9, (stats->end - first) / 1e9, stats->transactions, stats->iterations);\n";
+   outputFile << "      printf(\"\\\"iteration_mean_s\\\": %.9f, \\\"iteration_min_s\\\": %.9f, \\\"iteration_max_s\\\": %.9f}\",\n";
+   outputFile << "             stats->iterations ? stats->iterationTotal / 1e9 / stats->iterations : 0.0,\n";
+   outputFile << "             stats->iterations ? stats->iterationMin / 1e9 : 0.0, stats->iterationMax / 1e9);\n";
+   outputFile << "   }\n";
+   outputFile << "   printf(\"]}\\n\");\n";
    outputFile << "}\n";
 }
+
+/**
+ * @ingroup Body
+ * @brief   Per-transaction latency histogram
+ *
+ * @param outputFile 
+ *
+ * Every txLatencySample-th transaction of a thread is timed with the cycle counter (a nanosecond clock
+ * where there is none) and counted in a thread-local power-of-two histogram. Threads fold their
+ * histograms into the global one when they finish; main prints it as JSON at exit.
+ */
+void Body::latencyGen(std::ostream &outputFile)
+{
+   /* Variables */
+
+   /* Processes */
+   outputFile << "\n/* Transaction Latency */\n";
+   outputFile << "#include <time.h>\n\n";
+
+   outputFile << "#define PARAM_LATENCY_SAMPLE  " << txLatencySample << "\n";
+   outputFile << "#define PARAM_LATENCY_BUCKETS 64\n\n";
+
+   outputFile << "#if defined(__x86_64__) || defined(__i386__)\n";
+   outputFile << "#define PARAM_CYCLE_UNIT \"cycles\"\n";
+   outputFile << "#define PARAM_CYCLES() __builtin_ia32_rdtsc()\n";
+   outputFile << "#else\n";
+   outputFile << "#define PARAM_CYCLE_UNIT \"ns\"\n";
+   outputFile << "static unsigned long long PARAM_CYCLES(void)\n";
+   outputFile << "{\n";
+   outputFile << "   struct timespec now;\n\n";
+   outputFile << "   clock_gettime(CLOCK_MONOTONIC, &now);\n";
+   outputFile << "   return now.tv_sec * 1000000000ULL + now.tv_nsec;\n";
+   outputFile << "}\n";
+   outputFile << "#endif\n\n";
+
+   outputFile << "static __thread unsigned long long paramLatency[PARAM_LATENCY_BUCKETS];\n";
+   outputFile << "static __thread unsigned long long paramLatencyStart;\n";
+   outputFile << "static __thread unsigned int paramLatencyTick;\n";
+   writeGlobal(outputFile, "unsigned long long paramLatencyTotal[PARAM_LATENCY_BUCKETS]");
+   outputFile << "\n";
+
+   outputFile << "#define PARAM_LATENCY_BEGIN() do {\t\t\t\t\\\n";
+   outputFile << "        if(++paramLatencyTick >= PARAM_LATENCY_SAMPLE) {\t\\\n";
+   outputFile << "           paramLatencyTick = 0;\t\t\t\t\\\n";
+   outputFile << "           paramLatencyStart = PARAM_CYCLES();\t\\\n";
+   outputFile << "        }\t\t\t\t\t\t\\\n";
+   outputFile << "} while (0)\n\n";
+
+   outputFile << "#define PARAM_LATENCY_END() do {\t\t\t\t\\\n";
+   outputFile << "        if(paramLatencyStart) {\t\t\t\t\\\n";
+   outputFile << "           param_latency_record(PARAM_CYCLES() - paramLatencyStart);\t\\\n";
+   outputFile << "           paramLatencyStart = 0;\t\t\t\\\n";
+   outputFile << "        }\t\t\t\t\t\t\\\n";
+   outputFile << "} while (0)\n\n";
+
+   outputFile << "static inline void param_latency_record(unsigned long long cycles)\n";
+   outputFile << "{\n";
+   outputFile << "   paramLatency[cycles ? 63 - __builtin_clzll(cycles) : 0]++;\n";
+   outputFile << "}\n\n";
+
+   outputFile << "static void param_latency_flush(void)\n";
+   outputFile << "{\n";
+   outputFile << "   unsigned int bucket;\n\n";
+   outputFile << "   for(bucket = 0; bucket < PARAM_LATENCY_BUCKETS; bucket++)\n";
+   outputFile << "      __sync_fetch_and_add(&paramLatencyTotal[bucket], paramLatency[bucket]);\n";
+   outputFile << "}\n\n";
+
+   outputFile << "static void param_latency_report(void)\n";
+   outputFile << "{\n";
+   outputFile << "   unsigned int bucket, first = 1;\n\n";
+   outputFile << "   printf(\"{\\\"latency_unit\\\": \\\"%s\\\", \\\"sample_every\\\": %u, \\\"buckets\\\": [\", PARAM_CYCLE_UNIT, PARAM_LATENCY_SAMPLE);\n";
+   outputFile << "   for(bucket = 0; bucket < PARAM_LATENCY_BUCKETS; bucket++)\n";
+   outputFile << "   {\n";
+   outputFile << "      if(paramLatencyTotal[bucket] == 0)\n";
+   outputFile << "         continue;\n\n";
+   outputFile << "      printf(\"%s{\\\"min\\\": %llu, \\\"count\\\": %llu}\", first ? \"\" : \", \", bucket ? 1ULL << bucket : 0ULL, paramLatencyTotal[bucket]);\n";
+   outputFile << "      first = 0;\n";
+   outputFile << "   }\n";
+   outputFile << "   printf(\"]}\\n\");\n";
+   outputFile << "}\n";
+}
+
+/**
+ * @ingroup Body
+ * @brief   Pointer-chase region shared by every thread
+ *
+ * @param outputFile 
+ *
+ * The region has one node per line. Each node holds the address of the next node, and the nodes are
+ * linked in shuffled order, so following them visits every line once before repeating and the next
+ * address cannot be predicted. The region is read-only once built, so walking it adds to a
+ * transaction's read set without adding conflicts. Each thread's chains start at evenly spaced
+ * points of the cycle.
+ */
+void Body::chaseGen(std::ostream &outputFile)
+{
+   /* Variables */
+   std::string addressType = backend->get_addressType();
+
+   /* Processes */
+   outputFile << "\n/* Pointer-Chase Region -- one node per line, linked in a single random cycle */\n";
+   writeGlobal(outputFile, "int* chase_memInt");
+   writeGlobal(outputFile, addressType + " chase_data");
+   writeGlobal(outputFile, addressType + " chase_head[" + Instruction::IntToString(numThreads * MAX_CHASE_CHAINS) + "]");
+   outputFile << "\n";
+
+   outputFile << "static void param_chase_init(unsigned long nodes, unsigned long line)\n";
+   outputFile << "{\n";
+   outputFile << "   unsigned long *order = (unsigned long*)malloc(sizeof(unsigned long) * nodes);\n";
+   outputFile << "   unsigned long heads = sizeof(chase_head) / sizeof(chase_head[0]);\n";
+   outputFile << "   unsigned long node, pick, swap;\n";
+   outputFile << "   unsigned long long seed = 88172645463325252ULL;\n\n";
+
+   outputFile << "   for(node = 0; node < nodes; node++)\n";
+   outputFile << "      order[node] = node;\n\n";
+
+   outputFile << "   for(node = nodes - 1; node > 0; node--)\n";
+   outputFile << "   {\n";
+   outputFile << "      seed ^= seed << 13;\n";
+   outputFile << "      seed ^= seed >> 7;\n";
+   outputFile << "      seed ^= seed << 17;\n";
+   outputFile << "      pick = (unsigned long)(seed % (node + 1));\n";
+   outputFile << "      swap = order[node];\n";
+   outputFile << "      order[node] = order[pick];\n";
+   outputFile << "      order[pick] = swap;\n";
+   outputFile << "   }\n\n";
+
+   outputFile << "   for(node = 0; node < nodes; node++)\n";
+   outputFile << "      *(" << addressType << "*)(chase_data + order[node] * line) = chase_data + order[(node + 1) % nodes] * line;\n\n";
+
+   outputFile << "   for(node = 0; node < heads; node++)\n";
+   outputFile << "      chase_head[node] = chase_data + order[(unsigned long long)node * nodes / heads] * line;\n\n";
+
+   outputFile << "   free(order);\n";
+   outputFile << "}\n";
+}
+
+/**
+ * @ingroup Body
+ * @brief   Points the thread's chain registers at its starting nodes
+ *
+ * @param threadID 
+ * @param outputFile 
+ */
+void Body::chaseStartGen(THREAD_ID threadID, std::ostream &outputFile)
+{
+   for(UINT_32 chain = 0; chain < chaseChains; chain++)
+   {
+      if(sharedCode == 1)
+         outputFile << "   chase_" << chain << " = chase_head[param_tid * " << MAX_CHASE_CHAINS << " + " << chain << "];\n";
+      else
+         outputFile << "   chase_" << chain << " = chase_head[" << threadID * MAX_CHASE_CHAINS + chain << "];\n";
+   }
+}
+
+/**
+ * @ingroup Body
+ * @brief   Outcome table of each thread's conditional branches
+ *
+ * @param outputFile 
+ *
+ * A thread steps through its row once per branch. A random row is drawn with the thread's taken rate
+ * from a fixed seed, so no predictor can learn it; a pattern row repeats every period entries with
+ * the taken entries spread evenly, so a predictor with enough history learns it completely.
+ */
+void Body::branchGen(std::ostream &outputFile)
+{
+   outputFile << "\n/* Conditional-Branch Outcomes -- one row per thread */\n";
+   writeGlobal(outputFile, "unsigned char param_branch_table[" + Instruction::IntToString(numThreads) + "][" + Instruction::IntToString(BRANCH_TABLE) + "]");
+   outputFile << "\n";
+
+   outputFile << "static void param_branch_init(unsigned char *table, unsigned int permille, unsigned int period, unsigned int taken, unsigned long long seed)\n";
+   outputFile << "{\n";
+   outputFile << "   unsigned int entry;\n\n";
+
+   outputFile << "   for(entry = 0; entry < " << BRANCH_TABLE << "; entry++)\n";
+   outputFile << "   {\n";
+   outputFile << "      seed ^= seed << 13;\n";
+   outputFile << "      seed ^= seed >> 7;\n";
+   outputFile << "      seed ^= seed << 17;\n";
+   outputFile << "      if(period > 0)\n";
+   outputFile << "         table[entry] = (entry % period) * taken % period < taken;\n";
+   outputFile << "      else\n";
+   outputFile << "         table[entry] = seed % 1000 < permille;\n";
+   outputFile << "   }\n";
+   outputFile << "}\n";
+}
+
+/**
+ * @ingroup Body
+ * @brief   Fills each thread's outcome row before the threads start
+ *
+ * @param outputFile 
+ *
+ * branchTakenRate (0..1, default 0.5) and branchPattern (random, pattern or pattern:N, default
+ * random) are read from the thread, then Global; pattern alone repeats every 8 branches.
+ */
+void Body::branchInitGen(std::ostream &outputFile)
+{
+   for(THREAD_ID threadID = 0; threadID < numThreads; threadID++)
+   {
+      std::string threadRegion = "Thread" + Instruction::IntToString(threadID);
+      double takenRate = 0.5;
+      std::string patternSpec = "random";
+      UINT_32 period = 0;
+
+      if(config->keyExists(threadRegion, "branchTakenRate"))
+         takenRate = config->read<double>(threadRegion, "branchTakenRate");
+      else if(config->keyExists("Global", "branchTakenRate"))
+         takenRate = config->read<double>("Global", "branchTakenRate");
+
+      if(config->keyExists(threadRegion, "branchPattern"))
+         patternSpec = config->read<string>(threadRegion, "branchPattern");
+      else if(config->keyExists("Global", "branchPattern"))
+         patternSpec = config->read<string>("Global", "branchPattern");
+
+      if(patternSpec == "pattern")
+         period = 8;
+      else if(patternSpec.compare(0, 8, "pattern:") == 0)
+         period = atoi(patternSpec.c_str() + 8);
+
+      if(takenRate < 0.0 || takenRate > 1.0 || (patternSpec != "random" && (period < 1 || period > BRANCH_TABLE)))
+      {
+         std::cerr << "Bad branch outcomes for thread " << threadID << " -- branchTakenRate must be 0..1 and branchPattern random, pattern or pattern:N (1.." << BRANCH_TABLE << ")." << std::endl;
+         exit(1);
+      }
+
+      outputFile << "   param_branch_init(param_branch_table[" << threadID << "], " << UINT_32(takenRate * 1000 + 0.5) << ", " << period << ", ";
+      outputFile << UINT_32(takenRate * period + 0.5) << ", " << 88172645463325252ULL + threadID << "ULL);\n";
+   }
+}
+
+/**
+ * @ingroup Body
+ * @brief   Writes param_runtime.h, the native stand-in for sescapi.h
+ *
+ * @param outputFile 
+ *
+ * The barrier is a sense-reversing spin barrier: each thread flips a thread-local sense, the last
+ * arrival resets the count and publishes the new sense, and everyone else spins on it -- yielding
+ * once PARAM_SPIN_LIMIT is reached so oversubscribed runs still make progress.
+ */
+void Body::runtimeGen(std::ostream &outputFile)
+{
+   /* Variables */
+
+   /* Processes */
+   outputFile << "//  This file was automatically generated.\n//  Do not edit this file.\n//\n//\n";
+   outputFile << "/// @file param_runtime.h\n";
+   outputFile << "/// @brief POSIX threads runtime for TransPlant programs -- build with -pthread\n";
+   outputFile << "//\n// Copyright: See COPYING file that comes with this distribution\n//\n///////////////////////////////////////////////////////////////////////////////////\n\n";
+
+   outputFile << "#ifndef PARAM_RUNTIME_H\n";
+   outputFile << "#define PARAM_RUNTIME_H\n\n";
+
+   outputFile << "#include <sched.h>\n";
+   outputFile << "#include <pthread.h>\n\n";
+
+   outputFile << "//spins before a waiting thread starts yielding its core\n";
+   outputFile << "#ifndef PARAM_SPIN_LIMIT\n";
+   outputFile << "#define PARAM_SPIN_LIMIT 4096\n";
+   outputFile << "#endif\n\n";
+
+   outputFile << "#if defined(__x86_64__) || defined(__i386__)\n";
+   outputFile << "#define PARAM_PAUSE() __builtin_ia32_pause()\n";
+   outputFile << "#else\n";
+   outputFile << "#define PARAM_PAUSE() do { } while (0)\n";
+   outputFile << "#endif\n\n";
+
+   outputFile << "typedef struct\n";
+   outputFile << "{\n";
+   outputFile << "   volatile unsigned int count;\n";
+   outputFile << "   char pad[" << cacheLine - INT_SIZE << "];\n";
+   outputFile << "   volatile unsigned int sense;\n";
+   outputFile << "} param_barrier_t;\n\n";
+
+   outputFile << "static __thread unsigned int param_barrier_sense = 0;\n\n";
+
+   outputFile << "static inline void param_barrier(param_barrier_t *barrier, unsigned int numThreads)\n";
+   outputFile << "{\n";
+   outputFile << "   unsigned int sense = !param_barrier_sense;\n\n";
+   outputFile << "   param_barrier_sense = sense;\n";
+   outputFile << "   if(__sync_add_and_fetch(&barrier->count, 1) == numThreads)\n";
+   outputFile << "   {\n";
+   outputFile << "      barrier->count = 0;\n";
+   outputFile << "      __sync_synchronize();\n";
+   outputFile << "      barrier->sense = sense;\n";
+   outputFile << "   }\n";
+   outputFile << "   else\n";
+   outputFile << "   {\n";
+   outputFile << "      unsigned int spins = 0;\n\n";
+   outputFile << "      while(barrier->sense != sense)\n";
+   outputFile << "      {\n";
+   outputFile << "         if(++spins < PARAM_SPIN_LIMIT)\n";
+   outputFile << "            PARAM_PAUSE();\n";
+   outputFile << "         else\n";
+   outputFile << "            sched_yield();\n";
+   outputFile << "      }\n";
+   outputFile << "   }\n";
+   outputFile << "}\n\n";
+
+   outputFile << "#endif\n";
+}
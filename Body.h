@@ -24,27 +24,35 @@
 #ifndef BODY_H
 #define BODY_H
 
+#include <set>
 #include <vector>
 #include <string>
 #include <fstream>
+#include <sstream>
 #include <iomanip>
 #include <iostream>
 #include <boost/tuple/tuple.hpp>
 
 #include "Skin.h"
 #include "OperandList.h"
+#include "Backend.h"
+#include "AccessPattern.h"
 #include "param_types.h"
 #include "param_funcs.h"
 
 #define INT_SIZE     4
-#define CACHE_LINE  32
+#define CACHE_LINE  32                    //default line size (Global->cacheLineSize)
 
 #define MAX_UNIQUE 2048 * 4
-#define MEM_REGION MAX_UNIQUE * CACHE_LINE
+#define MEM_REGION(line) (MAX_UNIQUE * (line))
 
 // #define MAX_UNIQUE 256
 // #define MEM_REGION (MAX_UNIQUE * CACHE_LINE)
-#define MAX_MEM 4 * MEM_REGION
+#define MAX_MEM(line) (4 * MEM_REGION(line))
+
+#define WS_WINDOW (_15_BIT_RANGE + 1)     //bytes one base register reaches with 16-bit offsets
+
+#define BRANCH_TABLE 4096                 //outcomes per thread before a conditional branch repeats
 
 
 /**
@@ -62,8 +70,10 @@ class Body : public Skin
       Body(Skin &skinIn);
 
       void writeProgram(void);
+      static UINT_64 byteSize(const std::string &sizeIn);
+      static BOOL checkOptions(Config *configIn);
 
-      void writeInstruction(std::ofstream &outputFile, Instruction *instructionIn, OperandList &operandList);
+      void writeInstruction(std::ostream &outputFile, Instruction *instructionIn, OperandList &operandList);
       void translateInstruction(THREAD_ID threadID, Instruction *instructionIn, OperandList &operandList);
 
       static UINT_32 randMemory(UINT_32 min, UINT_32 max);
@@ -72,6 +82,10 @@ class Body : public Skin
 
 
    private:
+      //not copyable, like Skin
+      Body(const Body &bodyIn);
+      Body &operator=(const Body &bodyIn);
+
       /* Data */
       UINT_32 basicBlockLabel;
 
@@ -96,37 +110,99 @@ class Body : public Skin
 
       std::map< UINT_32, ADDRESS_INT > *addressMatch;
 
+      TxMode  txMode;                                                //how transaction boundaries are written
+      UINT_32 lockStripes;                                           //number of striped locks (stripedLock mode)
+      BOOL    bufferingTx;                                           //inside a striped section, writing to txBuffer
+      std::ostringstream txBuffer;                                   //striped section held until its lock set is known
+      std::set< UINT_32 > txStripes;                                 //stripes touched by the buffered section
+      RuntimeTarget runtime;                                         //thread creation and barriers
+      BOOL    measure;                                               //timing/transaction harness in the output
+      BOOL    txLatency;                                             //per-transaction latency histogram in the output
+      UINT_32 txLatencySample;                                       //time every Nth transaction
+      UINT_32 cacheLine;                                             //spacing of unique offsets, in bytes
+      double  falseSharing;                                          //fraction of private lines shared between threads
+      UINT_64 workingSet;                                            //bytes per region, 0 for the fixed MEM_REGION
+      UINT_32 workingSetWindows;                                     //WS_WINDOW-sized windows the bases rotate through
+      BOOL    hugePages;                                             //mmap regions with MADV_HUGEPAGE
+      BOOL    prefault;                                              //touch every region before the loop
+      BOOL    firstTouch;                                            //each thread touches its own private region
+      BOOL    zipfActive;                                            //inside a Zipf-model transaction
+      double  zipfSkew;                                              //skew of the current Zipf transaction
+      double  zipfCDFSkew;                                           //skew zipfCDF was built for
+      std::vector< double > zipfCDF;                                 //cumulative Zipf weights over the shared lines
+      InstSubType threadPattern;                                     //access pattern of cells without their own
+      UINT_32 threadPatternParameter;
+      AccessPattern globalLoadPattern;                               //where each stream's next unique offset lands
+      AccessPattern globalStorePattern;
+      AccessPattern privateLoadPattern;
+      AccessPattern privateStorePattern;
+      UINT_32 chaseChains;                                           //most pointer chains any cell walks, 0 for none
+      BOOL    condBranches;                                          //some cell has a conditional branch
+      UINT_32 branchLabel;                                           //conditional branches written by the thread
+      Backend *backend;                                              //target ISA, alive only during writeProgram
+
+      BOOL    splitOutput;                                           //one .c per thread with a shared header and a Makefile
+      std::string globalDefinitions;                                 //split output: definitions main's file makes for the header's externs
+      BOOL    sharedCode;                                            //homogeneous threads run one function built from one stream
+      UINT_32 codeThreads;                                           //instruction streams to write (numThreads unless sharedCode)
+
       std::vector< UINT_32 > *privateStoreOffsetList;
       std::vector< UINT_32 > *globalStoreOffsetList;
       std::vector< UINT_32 > *privateLoadOffsetList;
       std::vector< UINT_32 > *globalLoadOffsetList;
 
       /* Methods */
-      void writeLabel(std::ofstream &outputFile, THREAD_ID threadID);
-      void insertBarrier(std::ofstream &outputFile, UINT_32 numThreads);
-      void insertWait(std::ofstream &outputFile, UINT_32 numThreads);
-
-      void startTransSection(std::ofstream &outputFile, TX_ID transID);
-      void endTransSection(std::ofstream &outputFile, TX_ID transID);
-
-      void initCellLoopSection(std::ofstream &outputFile);
-      void beginCellLoopSection(std::ofstream &outputFile, THREAD_ID threadID);
-      void endCellLoopSection(std::ofstream &outputFile, THREAD_ID threadID, UINT_32 iterations);
-
-      void beginMultiCellLoopSection(std::ofstream &outputFile, THREAD_ID threadID, UINT_32 loopID);
-      void endMultiCellLoopSection(std::ofstream &outputFile, THREAD_ID threadID, UINT_32 loopID, UINT_32 iterations);
-
-      void beginBlockLoopSection(std::ofstream &outputFile, THREAD_ID threadID, UINT_32 loopID);
-      void endBlockLoopSection(std::ofstream &outputFile, THREAD_ID threadID, UINT_32 loopID, UINT_32 iterations);
-
-      void beginProgamIterations(std::ofstream &outputFile, THREAD_ID threadID);
-      void endProgamIterations(std::ofstream &outputFile);
-
-      void headerGen(std::ofstream &outputFile);
-      void trailerGen(std::ofstream &outputFile);
-
-      void funcHeaderGen(THREAD_ID threadID, std::ofstream &outputFile);
-      void funcTrailerGen(THREAD_ID threadID, std::ofstream &outputFile);
+      UINT_32 zipfRank(UINT_32 n);
+      UINT_32 zipfUniqueOffset(std::vector< UINT_32 > *offsetList);
+      void setAccessPattern(InstSubType pattern, UINT_32 parameter);
+      BOOL isFalselyShared(UINT_32 privateOffset) const;
+      UINT_64 regionSize(void) const;
+      std::string allocCall(UINT_64 ints, BOOL touch) const;
+      UINT_32 falseSharingCopies(void) const;
+      static std::string accessPatternSpec(Config *configIn, THREAD_ID threadID);
+
+      void writeLabel(std::ostream &outputFile, THREAD_ID threadID);
+      void insertBarrier(std::ostream &outputFile, UINT_32 numThreads);
+      void insertWait(std::ostream &outputFile, UINT_32 numThreads);
+
+      void startTransSection(std::ostream &outputFile, TX_ID transID);
+      void endTransSection(std::ostream &outputFile, TX_ID transID);
+      void writeLockMacros(std::ostream &outputFile);
+      void writeGlobal(std::ostream &outputFile, const std::string &declaration, const std::string &initializer = "");
+      std::string threadIndex(THREAD_ID threadID) const;
+
+      void initCellLoopSection(std::ostream &outputFile);
+      void beginCellLoopSection(std::ostream &outputFile, THREAD_ID threadID);
+      void endCellLoopSection(std::ostream &outputFile, THREAD_ID threadID, UINT_32 iterations);
+
+      void initNestedCellLoopSection(std::ostream &outputFile, UINT_32 extraIterations);
+      void endNestedCellLoopSection(std::ostream &outputFile, THREAD_ID threadID, UINT_32 iterations, UINT_32 outerIterations);
+
+      void beginMultiCellLoopSection(std::ostream &outputFile, THREAD_ID threadID, UINT_32 loopID);
+      void endMultiCellLoopSection(std::ostream &outputFile, THREAD_ID threadID, UINT_32 loopID, UINT_32 iterations);
+
+      void beginBlockLoopSection(std::ostream &outputFile, THREAD_ID threadID, UINT_32 loopID);
+      void endBlockLoopSection(std::ostream &outputFile, THREAD_ID threadID, UINT_32 loopID, UINT_32 iterations);
+
+      void beginProgamIterations(std::ostream &outputFile, THREAD_ID threadID);
+      void endProgamIterations(std::ostream &outputFile, THREAD_ID threadID);
+
+      void headerGen(std::ostream &outputFile);
+      void sharedHeaderGen(std::ostream &outputFile);
+      void splitHeaderGen(std::ostream &outputFile);
+      void makefileGen(const std::string &outputDir);
+      void trailerGen(std::ostream &outputFile);
+
+      void funcHeaderGen(THREAD_ID threadID, std::ostream &outputFile);
+      void allocatorGen(std::ostream &outputFile);
+      void harnessGen(std::ostream &outputFile);
+      void latencyGen(std::ostream &outputFile);
+      void chaseGen(std::ostream &outputFile);
+      void chaseStartGen(THREAD_ID threadID, std::ostream &outputFile);
+      void branchGen(std::ostream &outputFile);
+      void branchInitGen(std::ostream &outputFile);
+      void runtimeGen(std::ostream &outputFile);
+      void funcTrailerGen(THREAD_ID threadID, std::ostream &outputFile);
 };
 
 #endif
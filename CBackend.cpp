@@ -0,0 +1,166 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the implementation for the portable C backend.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Implementation: CBackend
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CBackend.h"
+
+std::string CBackend::intVariable(RegType registerIn) const
+{
+   return Instruction::getIntVariable(registerIn);
+}
+
+std::string CBackend::fpVariable(RegType registerIn) const
+{
+   return Instruction::getFPVariable(registerIn);
+}
+
+/**
+ * @ingroup Backend
+ * @brief   Lvalue for the word at offset bytes past the operand's base
+ *
+ * The shared base is read through the per-iteration local so that transactional code
+ * does not also read the global.
+ */
+std::string CBackend::address(const std::string &operand, UINT_32 offset)
+{
+   std::string base = variableName(operand);
+
+   if(base == "s_data_out_int")
+      base = "shared_base";
+
+   return "*(int *)(" + base + " + " + Instruction::IntToString(offset) + ")";
+}
+
+void CBackend::writeTransactionMacros(std::ostream &outputFile)
+{
+   outputFile << "#ifndef BEGIN_TRANSACTION\n";
+   outputFile << "#define BEGIN_TRANSACTION(n) __asm__ __volatile__ (\"\" : : : \"memory\")\n";
+   outputFile << "#endif\n\n";
+
+   outputFile << "#ifndef COMMIT_TRANSACTION\n";
+   outputFile << "#define COMMIT_TRANSACTION(n) __asm__ __volatile__ (\"\" : : : \"memory\")\n";
+   outputFile << "#endif\n";
+}
+
+void CBackend::writeSharedBase(std::ostream &outputFile)
+{
+   outputFile << "intptr_t s_data_out_int;\n";
+}
+
+void CBackend::writeRegisters(std::ostream &outputFile)
+{
+   outputFile << "   int r_out_t0 = 0, r_out_t1 = 0, r_out_t2 = 0, r_out_t3 = 0, r_out_t4 = 0, r_out_t5 = 0;\n";
+   outputFile << "   int r_out_s0 = 0, r_out_s1 = 0, r_out_s2 = 0, r_out_s3 = 0, r_out_s4 = 0, r_out_s5 = 0;\n";
+   outputFile << "   double r_out_f2 = 0.0, r_out_f4 = 0.0, r_out_f6 = 0.0, r_out_f8 = 0.0, r_out_f10 = 0.0, r_out_f12 = 0.0;\n";
+
+   outputFile << "\n   intptr_t data_out_int;\n";
+   outputFile << "   intptr_t data_out_float;\n";
+
+   //loop counters
+   outputFile << "   int cell_counter = 0;\t\t//inner loop counter\n";
+   outputFile << "   int block_counter = 0;\t\t//outer loop counter\n";
+   outputFile << "   int nest_counter = 0;\t\t//nested cell loop counter\n";
+}
+
+void CBackend::writeIterationSetup(std::ostream &outputFile)
+{
+   outputFile << "   intptr_t shared_base = s_data_out_int;\n";
+}
+
+/**
+ * @ingroup Backend
+ * @brief   Instructions are written individually
+ *
+ * @param outputFile
+ * @param instructionIn
+ * @param operandList
+ */
+void CBackend::writeInstruction(std::ostream &outputFile, Instruction *instructionIn, OperandList &operandList)
+{
+   /* Variables */
+
+   /* Processes */
+   if(instructionIn->get_opCode() == iALU)
+   {
+      outputFile << "   " << variableName(operandList.rd_variable) << " = " << variableName(operandList.rs_variable);
+      outputFile << " ^ " << variableName(operandList.rt_variable) << ";";
+   }
+   else if(instructionIn->get_opCode() == iMult)
+   {
+      //unsigned, so the product wraps instead of overflowing
+      outputFile << "   " << variableName(operandList.rd_variable) << " = (unsigned) " << variableName(operandList.rs_variable);
+      outputFile << " * (unsigned) " << variableName(operandList.rt_variable) << ";";
+   }
+   else if(instructionIn->get_opCode() == iDiv)
+   {
+      //unsigned, and the divisor made odd, so it can neither trap nor overflow
+      outputFile << "   " << variableName(operandList.rd_variable) << " = (unsigned) " << variableName(operandList.rs_variable);
+      outputFile << " / ((unsigned) " << variableName(operandList.rt_variable) << " | 1);";
+   }
+   else if(instructionIn->get_opCode() == fpALU)
+   {
+      outputFile << "   " << variableName(operandList.rd_variable) << " = " << variableName(operandList.rs_variable);
+      outputFile << " + " << variableName(operandList.rt_variable) << ";";
+   }
+   else if(instructionIn->get_opCode() == fpMult)
+   {
+      outputFile << "   " << variableName(operandList.rd_variable) << " = " << variableName(operandList.rs_variable);
+      outputFile << " * " << variableName(operandList.rt_variable) << ";";
+   }
+   else if(instructionIn->get_opCode() == fpDiv)
+   {
+      outputFile << "   " << variableName(operandList.rd_variable) << " = " << variableName(operandList.rs_variable);
+      outputFile << " / " << variableName(operandList.rt_variable) << ";";
+   }
+   else if(instructionIn->get_opCode() == iLoad && instructionIn->get_subCode() == MemChase)
+   {
+      outputFile << "   " << variableName(operandList.rd_variable) << " = *(intptr_t *)(" << variableName(operandList.rs_variable);
+      outputFile << " + " << operandList.offSet << ");";
+   }
+   else if(instructionIn->get_opCode() == iLoad)
+   {
+      outputFile << "   " << variableName(operandList.rd_variable) << " = " << address(operandList.rs_variable, operandList.offSet) << ";";
+   }
+   else if(instructionIn->get_opCode() == iStore)
+   {
+      outputFile << "   " << address(operandList.rt_variable, operandList.offSet) << " = " << variableName(operandList.rd_variable) << ";";
+   }
+   else if(instructionIn->get_opCode() == iBJ && instructionIn->get_subCode() == BJCond)
+   {
+      outputFile << "   if(" << variableName(operandList.rs_variable) << ") goto " << operandList.rd << ";\n";
+      outputFile << "   " << operandList.rd << ": ;";
+   }
+   else if(instructionIn->get_opCode() == iBJ)
+   {
+      outputFile << "   goto " << operandList.rd << ";";
+   }
+
+   outputFile << std::endl;
+}
+
+void CBackend::writeLabel(std::ostream &outputFile, const std::string &label)
+{
+   outputFile << "   " << label << ": ;";
+   outputFile << "\n";
+}
+
+void CBackend::writeCounterReset(std::ostream &outputFile, const std::string &counter, INT_32 value)
+{
+   outputFile << "   " << counter << " = " << value << ";\n";
+}
+
+void CBackend::writeLoopBranch(std::ostream &outputFile, const std::string &counter, UINT_32 iterations, const std::string &label)
+{
+   outputFile << "   if(++" << counter << " < " << iterations << ") goto " << label << ";\n";
+}
@@ -0,0 +1,55 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the interface for the portable C backend.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Interface: CBackend
+ * Plain C statements with no inline assembly: one statement per load, store or ALU
+ * operation. Software TM compilers (gcc -fgnu-tm) refuse asm inside transactions, so
+ * this is the backend used with the itm transaction mode. Optimizers remove loads
+ * whose value is never used, so the output should be built at -O0 to keep the mix.
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef C_BACKEND_H
+#define C_BACKEND_H
+
+#include "Backend.h"
+
+/**
+ * @ingroup Backend
+ * @brief   Portable C writer
+ *
+ */
+class CBackend : public Backend
+{
+   public:
+      /* Functions */
+      std::string          get_name(void) const { return "c"; }
+      std::string          get_addressType(void) const { return "intptr_t"; }
+
+      std::string          intVariable(RegType registerIn) const;
+      std::string          fpVariable(RegType registerIn) const;
+
+      void                 writeTransactionMacros(std::ostream &outputFile);
+      void                 writeSharedBase(std::ostream &outputFile);
+      void                 writeRegisters(std::ostream &outputFile);
+      void                 writeIterationSetup(std::ostream &outputFile);
+
+      void                 writeInstruction(std::ostream &outputFile, Instruction *instructionIn, OperandList &operandList);
+      void                 writeLabel(std::ostream &outputFile, const std::string &label);
+
+      void                 writeCounterReset(std::ostream &outputFile, const std::string &counter, INT_32 value);
+      void                 writeLoopBranch(std::ostream &outputFile, const std::string &counter, UINT_32 iterations, const std::string &label);
+
+   private:
+      static std::string   address(const std::string &operand, UINT_32 offset);
+};
+
+#endif
@@ -25,8 +25,19 @@ Cell::Cell ( )
   this->numMemoryOps = 0;
   this->numIntegerOps = 0;
   this->numFloatingPointOps = 0;
+  this->intMultShare = 0;
+  this->intDivShare = 0;
+  this->fpMultShare = 0;
+  this->fpDivShare = 0;
   this->cellType = Sequential;
   this->conflictModel = Random;
+  this->conflictSkew = 0;
+  this->accessPattern = iSubInvalid;
+  this->accessParameter = 0;
+  this->chaseCount = 0;
+  this->chaseLength = 0;
+  this->dependencyDistance = 0;
+  this->criticalPath = 0;
 
    /* basic block size is fixed here */
   this->basicBlockSize = 8;
@@ -43,8 +54,25 @@ Cell::Cell(const Cell &objectIn)
   numMemoryOps = objectIn.numMemoryOps;
   numIntegerOps = objectIn.numIntegerOps;
   numFloatingPointOps = objectIn.numFloatingPointOps;
+  intMultShare = objectIn.intMultShare;
+  intDivShare = objectIn.intDivShare;
+  fpMultShare = objectIn.fpMultShare;
+  fpDivShare = objectIn.fpDivShare;
   cellType = objectIn.cellType;
   conflictModel = objectIn.conflictModel;
+  conflictSkew = objectIn.conflictSkew;
+  accessPattern = objectIn.accessPattern;
+  accessParameter = objectIn.accessParameter;
+  chaseCount = objectIn.chaseCount;
+  chaseLength = objectIn.chaseLength;
+  dependencyDistance = objectIn.dependencyDistance;
+  criticalPath = objectIn.criticalPath;
+  basicBlockSize = objectIn.basicBlockSize;
+  loopCount = objectIn.loopCount;
+
+  //the conflict pairs live in the SkeletonStore, so copies share the same view
+  loadConflicts = objectIn.loadConflicts;
+  storeConflicts = objectIn.storeConflicts;
 }
 
 BOOL Cell::setNumInstructions ( UINT_64 val )
@@ -101,6 +129,42 @@ BOOL Cell::setConflictModel ( ConflictType val )
   return true;
 }
 
+BOOL Cell::setConflictSkew ( float val )
+{
+  this->conflictSkew = val;
+  return true;
+}
+
+BOOL Cell::setAccessPattern ( InstSubType val, UINT_32 parameter )
+{
+  this->accessPattern = val;
+  this->accessParameter = parameter;
+  return true;
+}
+
+BOOL Cell::setPointerChase ( UINT_32 count, UINT_32 length )
+{
+  this->chaseCount = count;
+  this->chaseLength = length;
+  return true;
+}
+
+BOOL Cell::setRegisterTarget ( UINT_32 distance, UINT_32 path )
+{
+  this->dependencyDistance = distance;
+  this->criticalPath = path;
+  return true;
+}
+
+BOOL Cell::setLongLatencyMix ( float intMult, float intDiv, float fpMult, float fpDiv )
+{
+  this->intMultShare = intMult;
+  this->intDivShare = intDiv;
+  this->fpMultShare = fpMult;
+  this->fpDivShare = fpDiv;
+  return true;
+}
+
 BOOL Cell::setCellType ( CellType val )
 {
   this->cellType = val;
@@ -152,6 +216,61 @@ ConflictType Cell::getConflictModel ( ) const
   return conflictModel;
 }
 
+float Cell::getConflictSkew ( ) const
+{
+  return conflictSkew;
+}
+
+InstSubType Cell::getAccessPattern ( ) const
+{
+  return accessPattern;
+}
+
+UINT_32 Cell::getAccessParameter ( ) const
+{
+  return accessParameter;
+}
+
+UINT_32 Cell::getChaseCount ( ) const
+{
+  return chaseCount;
+}
+
+UINT_32 Cell::getChaseLength ( ) const
+{
+  return chaseLength;
+}
+
+UINT_32 Cell::getDependencyDistance ( ) const
+{
+  return dependencyDistance;
+}
+
+UINT_32 Cell::getCriticalPath ( ) const
+{
+  return criticalPath;
+}
+
+float Cell::getIntMultShare ( ) const
+{
+  return intMultShare;
+}
+
+float Cell::getIntDivShare ( ) const
+{
+  return intDivShare;
+}
+
+float Cell::getFPMultShare ( ) const
+{
+  return fpMultShare;
+}
+
+float Cell::getFPDivShare ( ) const
+{
+  return fpDivShare;
+}
+
 CellType Cell::getCellType ( ) const
 {
   return cellType;
@@ -200,83 +319,59 @@ UINT_32 Cell::getLoopCount(void) const
 }
 
 /**
- * @name set_loadConflictList
+ * @name set_loadConflicts
  * 
- * @param inList 
+ * @param inRange 
  * @return 
- * @note This function takes a reference as an argument so the input list should be pointers or copied then updated or there will be corruption
+ * @note The range only views the pairs; the SkeletonStore that holds them must outlive the cell
  */
-BOOL Cell::set_loadConflictList(std::list< CONFLICT_PAIR > *inList)
+BOOL Cell::set_loadConflicts(const ConflictRange &inRange)
 {
-   loadConflictList = inList;
+   loadConflicts = inRange;
    return 1;
 }
 
 /**
- * @name set_storeConflictList
+ * @name set_storeConflicts
  * 
- * @param inList 
+ * @param inRange 
  * @return 
- * @note This function takes a reference as an argument so the input list should be pointers or copied then updated or there will be corruption
+ * @note The range only views the pairs; the SkeletonStore that holds them must outlive the cell
  */
-BOOL Cell::set_storeConflictList(std::list< CONFLICT_PAIR > *inList)
+BOOL Cell::set_storeConflicts(const ConflictRange &inRange)
 {
-   storeConflictList = inList;
+   storeConflicts = inRange;
    return 1;
 }
 
-std::list< CONFLICT_PAIR >* Cell::get_loadConflictList(void) const
-{
-   return this->loadConflictList;
-}
-
-std::list< CONFLICT_PAIR >* Cell::get_storeConflictList(void) const
-{
-   return this->storeConflictList;
-}
-
-BOOL Cell::delete_loadConflictList(void)
+const ConflictRange & Cell::get_loadConflicts(void) const
 {
-   delete loadConflictList;
+   return this->loadConflicts;
 }
 
-BOOL Cell::delete_storeConflictList(void)
+const ConflictRange & Cell::get_storeConflicts(void) const
 {
-   delete storeConflictList;
+   return this->storeConflicts;
 }
 
-BOOL Cell::push_loadConflictList(CONFLICT_PAIR inPair)
+BOOL Cell::print_loadConflicts(std::ostream &outputStream) const
 {
-   loadConflictList->push_back(inPair);
-   return 1;
-}
-
-BOOL Cell::push_storeConflictList(CONFLICT_PAIR inPair)
-{
-   storeConflictList->push_back(inPair);
-   return 1;
-}
-
-BOOL Cell::print_loadConflictList(std::ostream &outputStream)
-{
-   std::list< CONFLICT_PAIR >::iterator listIterator;
-
-   for(listIterator = loadConflictList->begin(); listIterator != loadConflictList->end(); listIterator++)
+   for(ConflictRange::const_iterator conflict_it = loadConflicts.begin(); conflict_it != loadConflicts.end(); conflict_it++)
    {
-      outputStream << "First:  " << listIterator->first << "   " << "Second:  " << listIterator->second << "\n";
+      outputStream << "First:  " << conflict_it->first << "   " << "Second:  " << conflict_it->second << "\n";
    }
    outputStream << std::endl;
+   return 1;
 }
 
-BOOL Cell::print_storeConflictList(std::ostream &outputStream)
+BOOL Cell::print_storeConflicts(std::ostream &outputStream) const
 {
-   std::list< CONFLICT_PAIR >::iterator listIterator;
-
-   for(listIterator = storeConflictList->begin(); listIterator != storeConflictList->end(); listIterator++)
+   for(ConflictRange::const_iterator conflict_it = storeConflicts.begin(); conflict_it != storeConflicts.end(); conflict_it++)
    {
-      outputStream << "First:  " << listIterator->first << "   " << "Second:  " << listIterator->second << "\n";
+      outputStream << "First:  " << conflict_it->first << "   " << "Second:  " << conflict_it->second << "\n";
    }
    outputStream << std::endl;
+   return 1;
 }
 
 /**
@@ -297,7 +392,23 @@ BOOL Cell::operator==(const Cell& cell) const
       return 0;
 
    //conflict Model (high - rnd)
-   if(conflictModel != cell.conflictModel)
+   if(conflictModel != cell.conflictModel || conflictSkew != cell.conflictSkew)
+      return 0;
+
+   //access pattern (line - stride - stream ...)
+   if(accessPattern != cell.accessPattern || accessParameter != cell.accessParameter)
+      return 0;
+
+   //pointer chains
+   if(chaseCount != cell.chaseCount || chaseLength != cell.chaseLength)
+      return 0;
+
+   //register dependences
+   if(dependencyDistance != cell.dependencyDistance || criticalPath != cell.criticalPath)
+      return 0;
+
+   //long-latency operations
+   if(intMultShare != cell.intMultShare || intDivShare != cell.intDivShare || fpMultShare != cell.fpMultShare || fpDivShare != cell.fpDivShare)
       return 0;
 
    //numInstructions
@@ -383,21 +494,21 @@ std::ostream& operator<<( std::ostream& os, const Cell& cell )
   os << "\nconflictModel:\t\t" << cell.getConflictModel ( );
   os << "\nbasicBlockSize:\t\t" << cell.getBasicBlockSize ( );
 
-  std::list< CONFLICT_PAIR > *loadConflictList = cell.get_loadConflictList ( );
-  std::list< CONFLICT_PAIR > *storeConflictList = cell.get_storeConflictList ( );
+  const ConflictRange &loadConflicts = cell.get_loadConflicts ( );
+  const ConflictRange &storeConflicts = cell.get_storeConflicts ( );
 
-  std::list< CONFLICT_PAIR >::iterator it;
+  ConflictRange::const_iterator it;
 
   os << "\nRead Set:";
 
-  for ( it = loadConflictList->begin() ; it != loadConflictList->end() ; it++ )
+  for ( it = loadConflicts.begin() ; it != loadConflicts.end() ; it++ )
   {
     os << "\n" << std::hex << it->first << "\t" << std::dec << it->second;
   }
 
   os << "\nWrite Set:";
 
-  for ( it = storeConflictList->begin() ; it != storeConflictList->end() ; it++ )
+  for ( it = storeConflicts.begin() ; it != storeConflicts.end() ; it++ )
   {
     os << "\n" << std::hex << it->first << "\t" << std::dec << it->second;
   }
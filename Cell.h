@@ -20,6 +20,7 @@
 
 #include "Config.h"
 #include "param_types.h"
+#include "ConflictRange.h"
 
 ///NOTE Cell-matching utiziles a tolerance defined as a percentage (i.e. 0.25)
 #define CELL_TOL 0.0
@@ -45,6 +46,11 @@ public:
          BOOL              setNumIntegerOps ( UINT_64 );         // Set number of integer opis
          BOOL              setNumFloatingPointOps ( UINT_64 );   // Set number of floating point ops
          BOOL              setConflictModel ( ConflictType );          // Set conflict model
+         BOOL              setConflictSkew ( float );                  // Set Zipf skew
+         BOOL              setAccessPattern ( InstSubType, UINT_32 );  // Set access pattern and its parameter
+         BOOL              setPointerChase ( UINT_32, UINT_32 );       // Set chain count and chain length
+         BOOL              setRegisterTarget ( UINT_32, UINT_32 );     // Set dependency distance and critical path
+         BOOL              setLongLatencyMix ( float, float, float, float );  // Set mult/div shares of int and fp ops
          BOOL              setCellType ( CellType );                   // Set cell type
 
          UINT_64           getNumInstructions ( ) const;               // Return number of instructions
@@ -56,6 +62,17 @@ public:
          UINT_64           getNumIntegerOps ( ) const;                 // Return number of integer opis
          UINT_64           getNumFloatingPointOps ( ) const;           // Return number of floating point ops
          ConflictType      getConflictModel ( ) const;                 // Return conflict model
+         float             getConflictSkew ( ) const;                  // Return Zipf skew
+         InstSubType       getAccessPattern ( ) const;                 // Return access pattern
+         UINT_32           getAccessParameter ( ) const;               // Return stride or stream count
+         UINT_32           getChaseCount ( ) const;                    // Return number of pointer chains
+         UINT_32           getChaseLength ( ) const;                   // Return dependent loads per chain
+         UINT_32           getDependencyDistance ( ) const;            // Return producers between a value and its use
+         UINT_32           getCriticalPath ( ) const;                  // Return target critical-path length
+         float             getIntMultShare ( ) const;                  // Return share of int ops that multiply
+         float             getIntDivShare ( ) const;                   // Return share of int ops that divide
+         float             getFPMultShare ( ) const;                   // Return share of fp ops that multiply
+         float             getFPDivShare ( ) const;                    // Return share of fp ops that divide
          CellType          getCellType ( ) const;                      // Return cell type
 
          BOOL              isTransaction ( );                          // Return true if cell is transactional
@@ -71,16 +88,12 @@ public:
 
          BOOL operator==( const Cell& cell ) const;
 
-         BOOL                          set_loadConflictList(std::list< CONFLICT_PAIR > *inList);
-         BOOL                          set_storeConflictList(std::list< CONFLICT_PAIR > *inList);
-         std::list< CONFLICT_PAIR >*   get_loadConflictList(void) const;
-         std::list< CONFLICT_PAIR >*   get_storeConflictList(void) const;
-         BOOL                          delete_loadConflictList(void);
-         BOOL                          delete_storeConflictList(void);
-         BOOL                          push_loadConflictList(CONFLICT_PAIR inPair);
-         BOOL                          push_storeConflictList(CONFLICT_PAIR inPair);
-         BOOL                          print_loadConflictList(std::ostream &outputStream);
-         BOOL                          print_storeConflictList(std::ostream &outputStream);
+         BOOL                          set_loadConflicts(const ConflictRange &inRange);
+         BOOL                          set_storeConflicts(const ConflictRange &inRange);
+         const ConflictRange &         get_loadConflicts(void) const;
+         const ConflictRange &         get_storeConflicts(void) const;
+         BOOL                          print_loadConflicts(std::ostream &outputStream) const;
+         BOOL                          print_storeConflicts(std::ostream &outputStream) const;
 
 private:
 
@@ -95,10 +108,21 @@ private:
          UINT_64        numMemoryOps;                               // Total number of Reads/Writes
          UINT_64        numIntegerOps;                              // Total number of Integer operations
          UINT_64        numFloatingPointOps;                        // Total number of Floating Point operations
+         float          intMultShare;                               // Fraction of Integer operations that multiply
+         float          intDivShare;                                // Fraction of Integer operations that divide
+         float          fpMultShare;                                // Fraction of Floating Point operations that multiply
+         float          fpDivShare;                                 // Fraction of Floating Point operations that divide
 
          // Enumerated Values
          CellType       cellType;                                   // Sequential = 0, Transactional = 1
          ConflictType   conflictModel;                              // Conflict Model: Random = 0, High = 1
+         float          conflictSkew;                               // Zipf exponent when conflictModel is Zipf
+         InstSubType    accessPattern;                              // Mem* pattern, iSubInvalid to follow the thread
+         UINT_32        accessParameter;                            // Stride bytes or interleaved streams
+         UINT_32        chaseCount;                                 // Pointer chains walked by the cell
+         UINT_32        chaseLength;                                // Dependent loads per chain
+         UINT_32        dependencyDistance;                         // Register reuse distance, 0 for random registers
+         UINT_32        criticalPath;                               // Longest dependence chain, 0 for no target
 
          // Needed for Body
          UINT_32        basicBlockSize;
@@ -106,9 +130,9 @@ private:
 
          friend std::ostream& operator<<( std::ostream& os, const Cell& cell );
 
-         //the beginning of the end -- so far as maintainability and performance goes
-         std::list< CONFLICT_PAIR > *loadConflictList;
-         std::list< CONFLICT_PAIR > *storeConflictList;
+         // Views into the SkeletonStore's flat conflict array
+         ConflictRange  loadConflicts;
+         ConflictRange  storeConflicts;
 
 };
 
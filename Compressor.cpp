@@ -25,9 +25,10 @@ char *delimiter_string = 0;
 
 #include "SequiterClasses.h"
 
-Compressor::Compressor(deque < Cell * > *cellIn)
+Compressor::Compressor(deque < Cell * > *cellIn, SkeletonStore *storeIn)
 {
    cellList = cellIn;
+   store = storeIn;
    maxRuleLength = 2;
    wasLoop = 0;
 
@@ -248,7 +249,7 @@ void Compressor::generateNewCellList()
       //if there is a loop , insert loop start cell
       if(elementCount > 1)
       {
-         Cell *temp = new Cell();
+         Cell *temp = store->newCell();
          temp->setCellType(LoopStart);
          temp->setLoopCount(elementCount);
          reduced_cellList->push_back(temp);
@@ -294,7 +295,7 @@ void Compressor::generateNewCellList()
       //if there is a loop, insert loop end cell
       if(elementCount > 1)
       {
-         Cell *temp = new Cell();
+         Cell *temp = store->newCell();
          temp->setCellType(LoopEnd);
          reduced_cellList->push_back(temp);
       }
@@ -531,7 +532,7 @@ for(std::deque < Cell * >::iterator boo= reduced_cellList->begin(); boo != reduc
 
 Cell* Compressor::generateSeqCell(UINT_32 numInstructions)
 {
-   Cell *boo = new Cell();
+   Cell *boo = store->newCell();
 
    return boo;
 }
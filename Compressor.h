@@ -23,6 +23,7 @@
 #include <boost/tuple/tuple.hpp>
 
 #include "Cell.h"
+#include "SkeletonStore.h"
 #include "Instruction.h"
 #include "param_types.h"
 #include "param_funcs.h"
@@ -38,7 +39,7 @@ class rules;
 class Compressor
 {
    public:
-      Compressor(deque < Cell * > *cellIn);
+      Compressor(deque < Cell * > *cellIn, SkeletonStore *storeIn);
       ~Compressor();
 
       void check(void);
@@ -67,6 +68,7 @@ class Compressor
 
       std::deque < Cell * > *cellList;
       std::deque < Cell * > *reduced_cellList;
+      SkeletonStore *store;                                       //owns the loop marker cells created here
       std::map <UINT_32, std::deque< UINT_32 > > cellMatches;     //map of cell->cell
       std::map <UINT_32, INT_32 > cellAliases;
 
@@ -0,0 +1,53 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the interface for the ConflictRange view.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Interface: ConflictRange
+ * A read-only window onto a run of conflict pairs held in a SkeletonStore. Cells keep
+ * one of these for their load and store conflicts instead of owning a list.
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CONFLICT_RANGE_H
+#define CONFLICT_RANGE_H
+
+#include <vector>
+
+#include "param_types.h"
+
+/**
+ * @ingroup ConflictRange
+ * @brief   Offset/count view into a flat conflict-pair array
+ *
+ */
+class ConflictRange
+{
+   public:
+      typedef const CONFLICT_PAIR * const_iterator;
+
+      /* Constructor */
+      ConflictRange() : pairs(0), offset(0), count(0) {}
+      ConflictRange(const std::vector< CONFLICT_PAIR > *pairsIn, UINT_32 offsetIn, UINT_32 countIn) : pairs(pairsIn), offset(offsetIn), count(countIn) {}
+
+      /* Functions */
+      const_iterator          begin(void) const { return count ? &(*pairs)[offset] : 0; }
+      const_iterator          end(void) const { return count ? &(*pairs)[offset] + count : 0; }
+
+      UINT_32                 size(void) const { return count; }
+      BOOL                    empty(void) const { return count == 0; }
+      const CONFLICT_PAIR &   front(void) const { return (*pairs)[offset]; }
+
+   private:
+      const std::vector< CONFLICT_PAIR > *pairs;
+      UINT_32 offset;
+      UINT_32 count;
+};
+
+#endif
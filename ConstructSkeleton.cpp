@@ -15,7 +15,9 @@
 
 #include "ConstructSkeleton.h"
 #include "Cell.h"
+#include "AccessPattern.h"
 #include "utilities/nanassert.h"
+#include "Stats.h"
 #include <deque>
 #include <math.h>
 
@@ -44,12 +46,25 @@ Skeleton ConstructSkeleton::createSkeleton (  )
   deque<string> threadNames = cf->readDeque<string>( "calculated", "threadStringDeque" );
   unsigned int numThreads = cf->read<unsigned int>("Global","numThreads");
   I( numThreads == threadNames.size ( ) );
+
+  // Homogeneous threads can all run the first thread's code, so only its cells are built
+  if ( cf->keyExists ( "Global" , "sharedCode" ) && cf->read<bool> ( "Global" , "sharedCode" ) )
+  {
+    if ( !cf->read<bool> ( "Global" , "homogeneous" ) )
+    {
+      cerr << "Fatal Error: sharedCode needs \"Global->homogeneous\" = true" << endl;
+      exit(1);
+    }
+    numThreads = 1;
+  }
+
   Skeleton skel ( numThreads );
 
   for ( unsigned int i = 0; i < numThreads; i++)
   {
-    THREAD_CELL_DEQUEP t = skel.getThread( i );
-    populateThread ( threadNames[i] , t );
+    Stats::beginStage ( "constructSkeleton", i );
+    populateThread ( threadNames[i] , skel, i );
+    Stats::endStage ( skel.getThread( i )->size() );
   }
 
    std::cout << std::endl;
@@ -61,9 +76,10 @@ Skeleton ConstructSkeleton::createSkeleton (  )
  * @ingroup ConstructSkeleton
  * 
  * @param thread 
- * @param tdeq 
+ * @param skel 
+ * @param threadID 
  */
-void ConstructSkeleton::populateThread ( string thread, THREAD_CELL_DEQUEP tdeq )
+void ConstructSkeleton::populateThread ( string thread, Skeleton &skel, unsigned int threadID )
 {
 
 /*****************************************************************/
@@ -72,12 +88,11 @@ void ConstructSkeleton::populateThread ( string thread, THREAD_CELL_DEQUEP tdeq
 
   unsigned int cellCount = calculateMinimumCellCount ( thread ) ;
 
-  // Create Cells (2x for both transactional and sequantial)
-  for (unsigned int x = 0; x < cellCount; x++ )
-  {
-    tdeq->push_back ( new Cell );
-    tdeq->push_back ( new Cell );
-  }
+  // Create Cells (2x for both transactional and sequantial) in one block of the store
+  skel.get_store ( )->allocateCells ( threadID, 2 * cellCount );
+  skel.linkThread ( threadID );
+
+  THREAD_CELL_DEQUEP tdeq = skel.getThread ( threadID );
 
   // Create Sequential / Transactional Pointer Deques
   deque < Cell * > seqCells;
@@ -555,6 +570,13 @@ void ConstructSkeleton::populateThread ( string thread, THREAD_CELL_DEQUEP tdeq
 /********* TRANSACTIONAL PORTION - CONFLICT DISTRIBUTION *********/
 /*****************************************************************/
 
+  // skew of zipf cells -- per thread, then global, then the usual 0.99
+  float zipfSkew = 0.99;
+  if ( cf->keyExists ( thread, "transConflictZipfSkew" ) )
+    zipfSkew = cf->read<float> ( thread, "transConflictZipfSkew" );
+  else if ( cf->keyExists ( "Global", "zipfSkew" ) )
+    zipfSkew = cf->read<float> ( "Global", "zipfSkew" );
+
 /// *** LIST OPTONS ***
 
   if ( cf->isOptionList ( thread, "transConflictDistributionModel" ) )
@@ -570,6 +592,23 @@ void ConstructSkeleton::populateThread ( string thread, THREAD_CELL_DEQUEP tdeq
       {
         transCells[ x ]->setConflictModel( Random );
       }
+      // zipf uses the default skew, zipf:S sets it for this cell
+      else if ( conflictDistModel [ x ].compare ( 0, 4, "zipf" ) == 0 )
+      {
+        float skew = zipfSkew;
+
+        if ( conflictDistModel [ x ].size ( ) > 5 && conflictDistModel [ x ] [ 4 ] == ':' )
+          skew = atof ( conflictDistModel [ x ].c_str ( ) + 5 );
+        else if ( conflictDistModel [ x ] != "zipf" )
+        {
+          cerr << "Fatal Error: Unrecognized transConflictDistributionModel input\n"
+              << "Transaction: " << x << "\nThread: " << thread << endl;
+          exit(1);
+        }
+
+        transCells[ x ]->setConflictModel( Zipf );
+        transCells[ x ]->setConflictSkew( skew );
+      }
       else
       {
           cerr << "Fatal Error: Unrecognized transConflictDistributionModel input\n"
@@ -619,11 +658,135 @@ void ConstructSkeleton::populateThread ( string thread, THREAD_CELL_DEQUEP tdeq
         case 1:
           transCells[ x ]->setConflictModel( Random );
           break;
+        case 2:
+          transCells[ x ]->setConflictModel( Zipf );
+          transCells[ x ]->setConflictSkew( zipfSkew );
+          break;
+      }
+    }
+  }
+
+
+
+/*****************************************************************/
+/********* TRANSACTIONAL PORTION - ACCESS PATTERN ****************/
+/*****************************************************************/
+
+/// *** LIST OPTONS ***
+
+  // Cells without an entry follow the thread's accessPattern
+  if ( cf->keyExists ( thread, "transAccessPattern" ) )
+  {
+    deque < string > accessPattern = cf->readDeque< string > ( thread, "transAccessPattern" );
+    for ( unsigned int x = 0; x < transCells.size ( ) && x < accessPattern.size ( ); x++ )
+    {
+      InstSubType pattern;
+      UINT_32 parameter;
+
+      if ( AccessPattern::parse ( accessPattern [ x ], pattern, parameter ) == 0 )
+      {
+          cerr << "Fatal Error: Unrecognized transAccessPattern input\n"
+              << "Transaction: " << x << "\nThread: " << thread << endl;
+          exit(1);
+      }
+
+      transCells[ x ]->setAccessPattern( pattern, parameter );
+    }
+  }
+
+/*****************************************************************/
+/********* TRANSACTIONAL PORTION - POINTER CHASING ***************/
+/*****************************************************************/
+
+/// *** LIST OPTONS ***
+
+  // One entry per transaction, or a single entry for all of them
+  if ( cf->keyExists ( thread, "transChaseCount" ) || cf->keyExists ( thread, "transChaseLength" ) )
+  {
+    deque < long > chaseCount ( 1, 1 );
+    deque < long > chaseLength ( 1, 1 );
+
+    if ( cf->keyExists ( thread, "transChaseCount" ) )
+      chaseCount = cf->readDeque< long > ( thread, "transChaseCount" );
+    if ( cf->keyExists ( thread, "transChaseLength" ) )
+      chaseLength = cf->readDeque< long > ( thread, "transChaseLength" );
+
+    for ( unsigned int x = 0; x < transCells.size ( ); x++ )
+    {
+      long count = chaseCount.size ( ) == 1 ? chaseCount [ 0 ] : ( x < chaseCount.size ( ) ? chaseCount [ x ] : 0 );
+      long length = chaseLength.size ( ) == 1 ? chaseLength [ 0 ] : ( x < chaseLength.size ( ) ? chaseLength [ x ] : 0 );
+
+      if ( count < 0 || count > MAX_CHASE_CHAINS || length < 0 )
+      {
+          cerr << "Fatal Error: transChaseCount must be between 0 and " << MAX_CHASE_CHAINS << " and transChaseLength at least 0\n"
+              << "Transaction: " << x << "\nThread: " << thread << endl;
+          exit(1);
+      }
+
+      transCells[ x ]->setPointerChase( count, length );
+    }
+  }
+
+/*****************************************************************/
+/********* TRANSACTIONAL PORTION - REGISTER DEPENDENCES **********/
+/*****************************************************************/
+
+/// *** LIST OPTONS ***
+
+  // One entry per transaction, or a single entry for all of them; a distance wins over a path
+  if ( cf->keyExists ( thread, "transDependencyDistance" ) || cf->keyExists ( thread, "transCriticalPath" ) )
+  {
+    deque < long > distance ( 1, 0 );
+    deque < long > path ( 1, 0 );
+
+    if ( cf->keyExists ( thread, "transDependencyDistance" ) )
+      distance = cf->readDeque< long > ( thread, "transDependencyDistance" );
+    if ( cf->keyExists ( thread, "transCriticalPath" ) )
+      path = cf->readDeque< long > ( thread, "transCriticalPath" );
+
+    for ( unsigned int x = 0; x < transCells.size ( ); x++ )
+    {
+      long cellDistance = distance.size ( ) == 1 ? distance [ 0 ] : ( x < distance.size ( ) ? distance [ x ] : 0 );
+      long cellPath = path.size ( ) == 1 ? path [ 0 ] : ( x < path.size ( ) ? path [ x ] : 0 );
+
+      if ( cellDistance < 0 || cellPath < 0 )
+      {
+          cerr << "Fatal Error: transDependencyDistance and transCriticalPath cannot be negative\n"
+              << "Transaction: " << x << "\nThread: " << thread << endl;
+          exit(1);
       }
+
+      transCells[ x ]->setRegisterTarget( cellDistance, cellPath );
     }
   }
 
+/*****************************************************************/
+/********* LONG-LATENCY OPERATIONS *******************************/
+/*****************************************************************/
+
+  // Four shares -- int mult, int div, fp mult, fp div -- of each cell's integer and
+  // floating-point operations; cells without them follow Global->longLatencyMix
+  for ( unsigned int portion = 0; portion < 2; portion++ )
+  {
+    string key = portion == 0 ? "transLongLatencyMix" : "sequentialLongLatencyMix";
+    deque < Cell * > &cells = portion == 0 ? transCells : seqCells;
+    deque < float > shares;
+
+    if ( cf->keyExists ( thread, key ) == 0 )
+      continue;
+    shares = cf->readDeque< float > ( thread, key );
 
+    if ( shares.size ( ) != 4 || shares [ 0 ] < 0 || shares [ 1 ] < 0 || shares [ 2 ] < 0 || shares [ 3 ] < 0
+         || shares [ 0 ] + shares [ 1 ] > 1.0 || shares [ 2 ] + shares [ 3 ] > 1.0 )
+    {
+        cerr << "Fatal Error: " << key << " takes four shares (int mult, int div, fp mult, fp div)"
+            << " and each pair must sum to at most 1\nThread: " << thread << endl;
+        exit(1);
+    }
+
+    for ( unsigned int x = 0; x < cells.size ( ); x++ )
+      cells[ x ]->setLongLatencyMix ( shares [ 0 ], shares [ 1 ], shares [ 2 ], shares [ 3 ] );
+  }
 
 /*****************************************************************/
 /********* TRANSACTIONAL PORTION - INSTRUCTION MIX ***************/
@@ -49,7 +49,7 @@ private:
 
           Config*           cf;                                         // Pointer to configuration
 
-          void              populateThread ( string thread, THREAD_CELL_DEQUEP tdeq );
+          void              populateThread ( string thread, Skeleton &skel, unsigned int threadID );
           unsigned int      calculateMinimumCellCount ( string thread );
 
 
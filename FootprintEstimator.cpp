@@ -0,0 +1,312 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the implementation for the FootprintEstimator object.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Implementation: FootprintEstimator
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <algorithm>
+
+#include "FootprintEstimator.h"
+#include "Body.h"
+
+#define TEXT_MAIN_BYTES 3000              //main(), the runtime and the region setup
+#define SOURCE_MAIN_BYTES 9000            //headers, regions and main() of the first file
+#define SOURCE_THREAD_BYTES 700           //function head and tail of every other file
+#define SOURCE_MIPS_BYTES 98              //one MIPS asm statement
+#define SOURCE_X86_BYTES 83               //one x86_64 asm statement
+#define SOURCE_PACKED_BYTES 30            //one instruction inside a packed statement
+#define SOURCE_C_BYTES 38                 //one C statement
+
+/**
+ * @ingroup FootprintEstimator
+ *
+ * @param configIn Reads Global->footprintReport, textBudget, sourceBudget, backend and txMode
+ */
+FootprintEstimator::FootprintEstimator(Config *configIn) : config(configIn), report(0), textBudget(0), sourceBudget(0), cells(0), lastTextBytes(0)
+{
+   if(config->keyExists("Global", "footprintReport"))
+      report = config->read<BOOL>("Global", "footprintReport");
+   if(config->keyExists("Global", "textBudget"))
+      textBudget = Body::byteSize(config->read<string>("Global", "textBudget"));
+   if(config->keyExists("Global", "sourceBudget"))
+      sourceBudget = Body::byteSize(config->read<string>("Global", "sourceBudget"));
+
+   if(config->keyExists("Global", "txMode"))
+      txModeName = config->read<string>("Global", "txMode");
+
+   //the same choice Body makes
+   if(config->keyExists("Global", "backend"))
+      backendName = config->read<string>("Global", "backend");
+   else if(txModeName == "itm")
+      backendName = "c";
+   else
+      backendName = "mips";
+}
+
+/**
+ * @ingroup FootprintEstimator
+ * @brief   Counts the static instructions of every thread
+ *
+ * @param skinIn Skin whose instruction streams are built
+ * @param cellsIn Cells the streams were built from
+ */
+void FootprintEstimator::estimate(const Skin &skinIn, UINT_64 cellsIn)
+{
+   /* Variables */
+   const std::deque< Instruction * > *instructionList;
+
+   /* Processes */
+   cells = cellsIn;
+   threadInstructions.clear();
+   threadStatements.clear();
+
+   for(THREAD_ID threadID = 0; (instructionList = skinIn.getInstructionList(threadID)) != 0; threadID++)
+   {
+      UINT_64 instructions = 0;
+      UINT_64 statements = 0;
+
+      for(std::deque< Instruction * >::const_iterator instructionList_it = instructionList->begin(); instructionList_it != instructionList->end(); instructionList_it++)
+      {
+         UINT_32 weight = instructionWeight(*instructionList_it);
+
+         instructions += weight;
+         if(weight > 0)
+            statements++;
+      }
+
+      threadInstructions.push_back(instructions);
+      threadStatements.push_back(statements);
+   }
+
+   if(report == 1 || hasBudget())
+      writeReport(std::cout);
+}
+
+/**
+ * @ingroup FootprintEstimator
+ * @brief   Machine instructions one entry of a stream becomes
+ *
+ * Counts the code Body writes around the entry too, e.g. the table read in front of a
+ * conditional branch or the counter update of a loop. Plain C is built at -O0, where a
+ * statement loads its operands, computes and stores the result.
+ */
+UINT_32 FootprintEstimator::instructionWeight(const Instruction *instructionIn) const
+{
+   /* Variables */
+   UINT_32 scale = (backendName == "c") ? 3 : 1;
+
+   /* Processes */
+   switch(instructionIn->get_opCode())
+   {
+      case iALU:
+      case iLoad:
+      case iStore:
+      case fpALU:
+      case fpMult:
+      case fpDiv:
+         return scale;
+
+      case iMult:
+         return backendName == "mips" ? 2 : scale;
+
+      case iDiv:
+         if(backendName == "mips")
+            return 2;
+         return backendName == "x86_64" ? 4 : scale + 1;
+
+      case iBJ:
+         return instructionIn->get_subCode() == BJCond ? 7 : 2;
+
+      case iBeginTX:
+      case iCommitTX:
+         if(txModeName.empty() || txModeName == "macro")
+            return 1;
+         return txModeName == "itm" ? 4 : 8;
+
+      case syncBarrier:
+         return 6;
+
+      case iInitLoop:
+         return instructionIn->get_subCode() == NestedCellLoop ? 2 : 1;
+
+      case iEndLoop:
+         return instructionIn->get_subCode() == NestedCellLoop ? 6 : 3;
+
+      default:
+         return 0;
+   }
+}
+
+/**
+ * @ingroup FootprintEstimator
+ * @brief   Bytes of source Body writes for a thread
+ */
+UINT_64 FootprintEstimator::sourceBytes(THREAD_ID threadID) const
+{
+   /* Variables */
+   UINT_64 fixed = (threadID == 0) ? SOURCE_MAIN_BYTES : SOURCE_THREAD_BYTES;
+   UINT_64 statement = (backendName == "mips") ? SOURCE_MIPS_BYTES : SOURCE_X86_BYTES;
+   UINT_32 compact = 0;
+
+   /* Processes */
+   if(config->keyExists("Global", "compactEmission"))
+      compact = config->read<unsigned int>("Global", "compactEmission");
+
+   if(backendName == "c")
+      return fixed + threadStatements[threadID] * SOURCE_C_BYTES;
+   if(compact > 1)
+      return fixed + threadStatements[threadID] * SOURCE_PACKED_BYTES + threadStatements[threadID] / compact * statement;
+
+   return fixed + threadStatements[threadID] * statement;
+}
+
+/**
+ * @ingroup FootprintEstimator
+ * @brief   Text bytes of a thread's code; the first thread carries main() as well
+ */
+UINT_64 FootprintEstimator::textBytes(THREAD_ID threadID) const
+{
+   return threadInstructions[threadID] * FOOTPRINT_TEXT_BYTES + (threadID == 0 ? TEXT_MAIN_BYTES : 0);
+}
+
+/**
+ * @ingroup FootprintEstimator
+ * @brief   Prints the estimate of each thread and of the program
+ */
+void FootprintEstimator::writeReport(std::ostream &outputFile) const
+{
+   outputFile << "\nStatic footprint (estimated, backend " << backendName << "):\n";
+   for(THREAD_ID threadID = 0; threadID < threadInstructions.size(); threadID++)
+   {
+      outputFile << "   T" << threadID << ":  " << threadInstructions[threadID] << " instructions   "
+                 << textBytes(threadID) << " text bytes   "
+                 << sourceBytes(threadID) << " source bytes\n";
+   }
+   outputFile << "   total:  " << get_instructions() << " instructions   " << get_textBytes() << " text bytes   " << get_sourceBytes() << " source bytes";
+   if(textBudget > 0)
+      outputFile << "   (text budget " << textBudget << ")";
+   if(sourceBudget > 0)
+      outputFile << "   (source budget " << sourceBudget << ")";
+   outputFile << std::endl;
+}
+
+/**
+ * @ingroup FootprintEstimator
+ * @brief   Chooses the next remedy for an estimate that is over budget
+ *
+ * Source first: compact emission is applied and the program estimated again, so the
+ * warning below only ever reports a packed estimate. Then text: every looped cell is held to its share of
+ * the budget (halving the previous limit when that is smaller) while each rebuild still
+ * shrinks the estimate, and the cells are compressed once that stops helping.
+ *
+ * @param compressed Whether the cells are already compressed
+ * @return What the caller should do next
+ */
+FootprintAction FootprintEstimator::shrink(BOOL compressed)
+{
+   /* Variables */
+   UINT_64 textBytes = get_textBytes();
+   UINT_32 compact = 0;
+   UINT_32 loopBudget = 0;
+
+   /* Processes */
+   if(config->keyExists("Global", "compactEmission"))
+      compact = config->read<unsigned int>("Global", "compactEmission");
+
+   if(sourceBudget > 0 && get_sourceBytes() > sourceBudget && backendName != "c" && compact < 2)
+   {
+      std::cout << "Source over budget -- packing asm statements (compactEmission = " << FOOTPRINT_COMPACT << ")" << std::endl;
+      config->add<unsigned int>("Global", "compactEmission", FOOTPRINT_COMPACT);
+      return FootprintRebuild;
+   }
+
+   if(textBudget > 0 && textBytes > textBudget)
+   {
+      if(config->keyExists("Global", "loopCodeBudget"))
+         loopBudget = config->read<unsigned int>("Global", "loopCodeBudget");
+
+      if(lastTextBytes == 0 || textBytes < lastTextBytes)
+      {
+         UINT_64 target = textBudget / FOOTPRINT_TEXT_BYTES / std::max(cells, UINT_64(1));
+
+         if(loopBudget > 0)
+            target = std::min(target, UINT_64(loopBudget / 2));
+         target = std::max(target, UINT_64(FOOTPRINT_MIN_LOOP_BUDGET));
+
+         if(loopBudget == 0 || target < loopBudget)
+         {
+            std::cout << "Text over budget -- limiting cells to " << target << " instructions (loopCodeBudget)" << std::endl;
+            config->add<unsigned int>("Global", "loopCodeBudget", target);
+            config->add<double>("Global", "loopObjective", 1.0);
+            lastTextBytes = textBytes;
+            return FootprintRebuild;
+         }
+      }
+
+      if(compressed == 0)
+      {
+         std::cout << "Text over budget -- compressing cells" << std::endl;
+         lastTextBytes = textBytes;
+         return FootprintCompress;
+      }
+
+      std::cerr << "Warning: estimated text (" << textBytes << " bytes) is still over the budget of " << textBudget << " bytes." << std::endl;
+   }
+
+   if(sourceBudget > 0 && get_sourceBytes() > sourceBudget)
+      std::cerr << "Warning: estimated source (" << get_sourceBytes() << " bytes) is still over the budget of " << sourceBudget << " bytes." << std::endl;
+
+   return FootprintDone;
+}
+
+/**
+ * @ingroup FootprintEstimator
+ * @return Machine instructions of the whole program
+ */
+UINT_64 FootprintEstimator::get_instructions(void) const
+{
+   UINT_64 total = 0;
+
+   for(THREAD_ID threadID = 0; threadID < threadInstructions.size(); threadID++)
+      total += threadInstructions[threadID];
+
+   return total;
+}
+
+/**
+ * @ingroup FootprintEstimator
+ * @return Text bytes of the whole program
+ */
+UINT_64 FootprintEstimator::get_textBytes(void) const
+{
+   UINT_64 total = 0;
+
+   for(THREAD_ID threadID = 0; threadID < threadInstructions.size(); threadID++)
+      total += textBytes(threadID);
+
+   return total;
+}
+
+/**
+ * @ingroup FootprintEstimator
+ * @return Source bytes of the whole program
+ */
+UINT_64 FootprintEstimator::get_sourceBytes(void) const
+{
+   UINT_64 total = 0;
+
+   for(THREAD_ID threadID = 0; threadID < threadStatements.size(); threadID++)
+      total += sourceBytes(threadID);
+
+   return total;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the interface for the FootprintEstimator object.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Interface: FootprintEstimator
+ * Estimates the static size of the program Skin has built before Body writes it: the
+ * machine instructions each thread emits, the text bytes they take and the bytes of
+ * source Body will write. Loops count once, so these are static figures, not dynamic
+ * ones. With Global->textBudget or Global->sourceBudget set, shrink() picks the next
+ * remedy when the estimate is over budget:
+ *    source  -- compact emission
+ *    text    -- tighter loopCodeBudget with loopObjective = 1, halved while it helps,
+ *               then compression of the cells
+ * Each remedy rebuilds the instruction streams, so the next estimate reflects it.
+ * The weights are approximations of what each backend writes, good to within a few
+ * tens of percent.
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FOOTPRINT_ESTIMATOR_H
+#define FOOTPRINT_ESTIMATOR_H
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include "param_types.h"
+#include "Config.h"
+#include "Skin.h"
+
+#define FOOTPRINT_TEXT_BYTES 4            //text bytes per machine instruction
+#define FOOTPRINT_COMPACT 8               //compactEmission set by the source remedy
+#define FOOTPRINT_MIN_LOOP_BUDGET 16      //tightest loopCodeBudget the loop remedy sets
+
+enum FootprintAction
+{
+   FootprintDone,                         //within budget, or nothing left to try
+   FootprintRebuild,                      //the configuration changed; build the instructions again
+   FootprintCompress                      //compress the cells, then build the instructions again
+};
+
+/**
+ * @ingroup FootprintEstimator
+ * @brief   Static code-size estimate and budget enforcement
+ *
+ */
+class FootprintEstimator
+{
+   public:
+      /* Constructor */
+      FootprintEstimator(Config *configIn);
+
+      /* Functions */
+      BOOL                 isEnabled(void) const { return report || hasBudget(); }
+      BOOL                 hasBudget(void) const { return textBudget > 0 || sourceBudget > 0; }
+
+      void                 estimate(const Skin &skinIn, UINT_64 cellsIn);
+      void                 writeReport(std::ostream &outputFile) const;
+      FootprintAction      shrink(BOOL compressed);
+
+      UINT_64              get_instructions(void) const;
+      UINT_64              get_textBytes(void) const;
+      UINT_64              get_sourceBytes(void) const;
+
+   private:
+      Config *             config;
+      std::string          backendName;
+      std::string          txModeName;
+
+      BOOL                 report;
+      UINT_64              textBudget;                            //bytes; 0 for none
+      UINT_64              sourceBudget;                          //bytes; 0 for none
+
+      UINT_64              cells;
+      UINT_64              lastTextBytes;                         //estimate before the last rebuild
+      std::vector< UINT_64 > threadInstructions;                  //machine instructions
+      std::vector< UINT_64 > threadStatements;                    //instructions written as asm statements or C lines
+
+      UINT_32              instructionWeight(const Instruction *instructionIn) const;
+      UINT_64              textBytes(THREAD_ID threadID) const;
+      UINT_64              sourceBytes(THREAD_ID threadID) const;
+};
+
+#endif
@@ -184,67 +184,67 @@ BOOL Instruction::set_conflictModel(ConflictType conflictModel)
    return 1;
 }
 
-InstType Instruction::get_opCode()
+InstType Instruction::get_opCode() const
 {
    return this->opCode;
 }
 
-InstSubType Instruction::get_subCode()
+InstSubType Instruction::get_subCode() const
 {
    return this->subCode;
 }
 
-RegType Instruction::get_rs()
+RegType Instruction::get_rs() const
 {
    return this->rs;
 }
 
-RegType Instruction::get_rt()
+RegType Instruction::get_rt() const
 {
    return this->rt;
 }
 
-RegType Instruction::get_rd()
+RegType Instruction::get_rd() const
 {
    return this->rd;
 }
 
-INT_64 Instruction::get_immediate()
+INT_64 Instruction::get_immediate() const
 {
    return this->immediate;
 }
 
-ADDRESS_INT Instruction::get_virtualAddress()
+ADDRESS_INT Instruction::get_virtualAddress() const
 {
    return this->virtualAddress;
 }
 
-ADDRESS_INT Instruction::get_physicalAddress()
+ADDRESS_INT Instruction::get_physicalAddress() const
 {
    return this->physicalAddress;
 }
 
-BOOL Instruction::get_isShared()
+BOOL Instruction::get_isShared() const
 {
    return this->isShared;
 }
 
-BOOL Instruction::get_isUnique()
+BOOL Instruction::get_isUnique() const
 {
    return this->isUnique;
 }
 
-INT_32 Instruction::get_matchedInstruction()
+INT_32 Instruction::get_matchedInstruction() const
 {
    return this->matched;
 }
 
-UINT_32 Instruction::get_iterations()
+UINT_32 Instruction::get_iterations() const
 {
    return this->iterations;
 }
 
-UINT_32 Instruction::get_instructionID()
+UINT_32 Instruction::get_instructionID() const
 {
    return this->instructionID;
 }
@@ -262,6 +262,16 @@ ConflictType Instruction::get_conflictModel(void) const
    return conflictModel;
 }
 
+BOOL Instruction::is_intArithmetic(void) const
+{
+   return opCode == iALU || opCode == iMult || opCode == iDiv;
+}
+
+BOOL Instruction::is_fpArithmetic(void) const
+{
+   return opCode == fpALU || opCode == fpMult || opCode == fpDiv;
+}
+
 //only a subset of the registers are used, the rest are
 //reserved for variables required to maintain state
 //information in the synthetic
@@ -52,21 +52,24 @@ class Instruction
       BOOL           set_instructionID(UINT_32 instructionID);
       BOOL           set_conflictModel(ConflictType conflictModel);
 
-      InstType       get_opCode(void);
-      InstSubType    get_subCode(void);
-      RegType        get_rs(void);
-      RegType        get_rt(void);
-      RegType        get_rd(void);
-      INT_64         get_immediate(void);
-      ADDRESS_INT    get_virtualAddress(void);
-      ADDRESS_INT    get_physicalAddress(void);
-      BOOL           get_isShared(void);
-      BOOL           get_isUnique(void);
-      INT_32         get_matchedInstruction(void);
-      UINT_32        get_iterations(void);
-      UINT_32        get_instructionID(void);
+      InstType       get_opCode(void) const;
+      InstSubType    get_subCode(void) const;
+      RegType        get_rs(void) const;
+      RegType        get_rt(void) const;
+      RegType        get_rd(void) const;
+      INT_64         get_immediate(void) const;
+      ADDRESS_INT    get_virtualAddress(void) const;
+      ADDRESS_INT    get_physicalAddress(void) const;
+      BOOL           get_isShared(void) const;
+      BOOL           get_isUnique(void) const;
+      INT_32         get_matchedInstruction(void) const;
+      UINT_32        get_iterations(void) const;
+      UINT_32        get_instructionID(void) const;
       ConflictType   get_conflictModel(void) const;
 
+      BOOL           is_intArithmetic(void) const;       //iALU, iMult or iDiv
+      BOOL           is_fpArithmetic(void) const;        //fpALU, fpMult or fpDiv
+
       static RegType       identifyRegister(INT_32 registerNum);
       static std::string   getIntVariable(RegType registerIn);
       static std::string   getFPVariable(RegType registerIn);
@@ -0,0 +1,282 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the implementation for the LoopSolver object.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Implementation: LoopSolver
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "LoopSolver.h"
+#include "param_funcs.h"
+#include "utilities/nanassert.h"
+
+/**
+ * @ingroup LoopSolver
+ *
+ * @param codeBudgetIn Most instructions (body + remainder) a looped cell may emit; 0 for no limit
+ * @param objectiveIn Weight of code size against mix fidelity, clamped to [0, 1]
+ */
+LoopSolver::LoopSolver(UINT_32 codeBudgetIn, double objectiveIn) : codeBudget(codeBudgetIn)
+{
+   objective = std::min(1.0, std::max(0.0, objectiveIn));
+}
+
+/**
+ * @ingroup LoopSolver
+ * @brief   Divides memory operations into loads and stores
+ *
+ * Loads get 5/7 of the operations when both unique reads and writes exist. The split is
+ * then raised so that there are at least as many loads (stores) as there are shared or
+ * unique reads (writes).
+ *
+ * @param demand
+ * @param numMemOps
+ * @param numLoadOps
+ * @param numStoreOps
+ */
+void LoopSolver::splitMemory(const LoopDemand &demand, UINT_64 numMemOps, UINT_64 &numLoadOps, UINT_64 &numStoreOps)
+{
+   numLoadOps = numStoreOps = 0;
+
+   if(demand.uniqueWrites > 0 && demand.uniqueReads > 0 && demand.sharedReads < demand.uniqueReads && demand.sharedWrites < demand.uniqueWrites)
+   {
+      numLoadOps  = numMemOps * 5 / 7;
+      numStoreOps = numMemOps - numLoadOps;
+   }
+   else if(demand.uniqueReads > 0 && demand.sharedReads == demand.uniqueReads)
+   {
+      numLoadOps = demand.uniqueReads;
+      numStoreOps = numMemOps - numLoadOps;
+   }
+   else if(demand.uniqueWrites > 0 && demand.sharedWrites == demand.uniqueWrites)
+   {
+      numStoreOps = demand.uniqueWrites;
+      numLoadOps = numMemOps - numStoreOps;
+   }
+   else if(demand.uniqueWrites > 0)
+   {
+      numLoadOps  = 0;
+      numStoreOps = numMemOps;
+   }
+   else if(demand.uniqueReads > 0)
+   {
+      numStoreOps = 0;
+      numLoadOps  = numMemOps;
+   }
+   else
+   {
+      std::cerr << "Ow! -- R(" << demand.uniqueReads << ") W(" << demand.uniqueWrites << ")" << "\n";
+   }
+
+   if(numLoadOps < std::max(demand.sharedReads, demand.uniqueReads))
+   {
+      numLoadOps = std::max(demand.sharedReads, demand.uniqueReads);
+      numStoreOps = numMemOps - numLoadOps;
+   }
+   else if(numStoreOps < std::max(demand.sharedWrites, demand.uniqueWrites))
+   {
+      numStoreOps = std::max(demand.sharedWrites, demand.uniqueWrites);
+      numLoadOps = numMemOps - numStoreOps;
+   }
+}
+
+/**
+ * @ingroup LoopSolver
+ * @brief   The whole cell written out once, with no loop
+ */
+LoopShape LoopSolver::straightLine(const LoopDemand &demand) const
+{
+   /* Variables */
+   LoopShape shape;
+
+   /* Processes */
+   shape.useLoops = 0;
+   shape.loopSize = demand.numMemOps + demand.numIntegerOps + demand.numFloatOps;
+   shape.numIters = 1;
+   shape.remainder = 0;
+
+   shape.numMemOps = demand.numMemOps;
+   shape.numIntegerOps = demand.numIntegerOps;
+   shape.numFloatOps = demand.numFloatOps;
+   splitMemory(demand, shape.numMemOps, shape.numLoadOps, shape.numStoreOps);
+
+   shape.remMemOps = shape.remIntOps = shape.remFltOps = 0;
+
+   //the mix is exact, so only the code size counts
+   shape.cost = objective;
+
+   return shape;
+}
+
+/**
+ * @ingroup LoopSolver
+ * @brief   Fills in and scores the shape for one body size
+ *
+ * The body keeps the cell's mix as closely as rounding allows, but always holds every
+ * unique read and write and the loop overhead. The loop overhead counts as integer work.
+ *
+ * @param demand
+ * @param loopSize Body size including EXTRA_LOOP_OPS
+ * @param shape
+ * @return 0 if no valid loop has this body size
+ */
+BOOL LoopSolver::evaluate(const LoopDemand &demand, UINT_32 loopSize, LoopShape &shape) const
+{
+   /* Variables */
+   UINT_64  totalIns = demand.numMemOps + demand.numIntegerOps + demand.numFloatOps;
+   UINT_64  minMem = std::max(demand.sharedReads, demand.uniqueReads) + std::max(demand.sharedWrites, demand.uniqueWrites);
+
+   double   pctMem = double(demand.numMemOps) / totalIns;
+   double   pctFlt = double(demand.numFloatOps) / totalIns;
+
+   UINT_64  bodyMem, bodyFlt, bodyInt;
+   UINT_64  remMem, remFlt, remInt;
+
+   /* Processes */
+   if(loopSize <= EXTRA_LOOP_OPS || loopSize > _15_BIT_RANGE || totalIns / loopSize < 2)
+      return 0;
+
+   bodyMem = std::max(UINT_64(roundFloat(loopSize * pctMem)), minMem);
+   bodyFlt = roundFloat(loopSize * pctFlt);
+
+   if(bodyMem + EXTRA_LOOP_OPS > loopSize)
+      return 0;
+
+   if(bodyMem + bodyFlt + EXTRA_LOOP_OPS > loopSize)
+      bodyFlt = loopSize - bodyMem - EXTRA_LOOP_OPS;
+
+   bodyInt = loopSize - bodyMem - bodyFlt;
+
+   shape.useLoops = 1;
+   shape.loopSize = loopSize;
+   shape.numIters = totalIns / loopSize;
+   shape.remainder = totalIns % loopSize;
+
+   //the remainder is straight-line and simply follows the mix
+   remMem = roundFloat(shape.remainder * pctMem);
+   remFlt = roundFloat(shape.remainder * pctFlt);
+
+   if(remMem > shape.remainder)
+      remMem = shape.remainder;
+   if(remMem + remFlt > shape.remainder)
+      remFlt = shape.remainder - remMem;
+
+   remInt = shape.remainder - remMem - remFlt;
+
+   shape.numMemOps = bodyMem;
+   shape.numFloatOps = bodyFlt;
+   shape.numIntegerOps = bodyInt - EXTRA_LOOP_OPS;
+   splitMemory(demand, shape.numMemOps, shape.numLoadOps, shape.numStoreOps);
+
+   shape.remMemOps = remMem;
+   shape.remIntOps = remInt;
+   shape.remFltOps = remFlt;
+
+   //cost -- code size as a fraction of the straight-line cell, drift as the fraction of instructions that changed class
+   double codeSize = double(loopSize + shape.remainder) / totalIns;
+   double drift = std::fabs(double(shape.numIters * bodyMem + remMem) - demand.numMemOps);
+   drift = drift + std::fabs(double(shape.numIters * bodyInt + remInt) - demand.numIntegerOps);
+   drift = drift + std::fabs(double(shape.numIters * bodyFlt + remFlt) - demand.numFloatOps);
+   drift = drift / (2.0 * totalIns);
+
+   shape.cost = objective * codeSize + (1.0 - objective) * drift;
+
+   return 1;
+}
+
+/**
+ * @ingroup LoopSolver
+ * @brief   Picks the cheapest loop shape for a cell
+ *
+ * For a trip count k the remainder is smallest at the largest body with that trip count,
+ * floor(T / k). Below sqrt(T) every body size is scored directly and above it only those
+ * sizes, so a cell of T instructions costs O(sqrt(T)) evaluations. Ties go to the smaller body.
+ *
+ * @param demand
+ * @param allowLoops 0 forces the straight-line shape
+ * @return Chosen shape
+ */
+LoopShape LoopSolver::solve(const LoopDemand &demand, BOOL allowLoops) const
+{
+   /* Variables */
+   UINT_64  totalIns = demand.numMemOps + demand.numIntegerOps + demand.numFloatOps;
+   UINT_64  minMem = std::max(demand.sharedReads, demand.uniqueReads) + std::max(demand.sharedWrites, demand.uniqueWrites);
+
+   LoopShape best = straightLine(demand);
+   LoopShape smallest = best;                                        //fallback when nothing fits the budget
+   LoopShape candidate;
+
+   BOOL     withinBudget = (codeBudget == 0 || totalIns <= codeBudget);
+   BOOL     foundLoop = 0;
+
+   /* Processes */
+   if(allowLoops == 0 || totalIns == 0)
+      return best;
+
+   UINT_64 minSize = minMem + EXTRA_LOOP_OPS;
+   UINT_64 maxSize = std::min(UINT_64(_15_BIT_RANGE), totalIns / 2);
+   UINT_64 rootSize = UINT_64(std::sqrt(double(totalIns)));
+
+   if(minSize > maxSize)
+      return best;
+
+   //every small body, then the largest body for each small trip count
+   std::vector< UINT_64 > sizes;
+   for(UINT_64 loopSize = minSize; loopSize <= std::min(rootSize, maxSize); loopSize++)
+      sizes.push_back(loopSize);
+
+   for(UINT_64 numIters = totalIns / (rootSize + 1); numIters >= 2; numIters--)
+   {
+      UINT_64 loopSize = totalIns / numIters;
+      if(loopSize > rootSize && loopSize >= minSize && loopSize <= maxSize && (sizes.empty() || sizes.back() != loopSize))
+         sizes.push_back(loopSize);
+   }
+
+   for(std::vector< UINT_64 >::iterator size_it = sizes.begin(); size_it != sizes.end(); size_it++)
+   {
+      if(evaluate(demand, *size_it, candidate) == 0)
+         continue;
+
+      UINT_64 emitted = candidate.loopSize + candidate.remainder;
+
+      if(foundLoop == 0 || emitted < smallest.loopSize + smallest.remainder)
+         smallest = candidate;
+      foundLoop = 1;
+
+      if(codeBudget > 0 && emitted > codeBudget)
+         continue;
+
+      if(withinBudget == 0 || candidate.cost < best.cost)
+      {
+         best = candidate;
+         withinBudget = 1;
+      }
+   }
+
+   if(withinBudget == 0)
+   {
+      if(foundLoop == 1)
+         best = smallest;
+
+      std::cerr << "\nNo loop shape fits the code budget (" << codeBudget << "); emitting " << best.loopSize + best.remainder << " instructions." << std::endl;
+   }
+
+   #if defined(VERBOSE)
+   std::cout << "\nLOOP SOLVER -- candidates:  " << sizes.size() << "\tsize:  " << best.loopSize << "\titers:  " << best.numIters;
+   std::cout << "\tremainder:  " << best.remainder << "\tcost:  " << best.cost << std::endl;
+   #endif
+
+   return best;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the interface for the LoopSolver object.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Interface: LoopSolver
+ * Chooses the shape of a cell loop -- body size, trip count and the straight-line
+ * remainder -- from the cell's instruction mix and memory requirements. Every body
+ * size whose trip count is distinct is scored and the cheapest one is returned, where
+ * the cost weighs the emitted code size against how far the generated mix drifts from
+ * the requested one.
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef LOOP_SOLVER_H
+#define LOOP_SOLVER_H
+
+#include "param_types.h"
+
+///NOTE Internal loops require 3 integer ALU ops and 1 branch per cell
+#define EXTRA_LOOP_OPS 4
+
+/**
+ * @ingroup LoopSolver
+ * @brief   Requested operation counts for one cell
+ */
+struct LoopDemand
+{
+   UINT_64  numMemOps;
+   UINT_64  numIntegerOps;
+   UINT_64  numFloatOps;
+
+   UINT_64  uniqueReads, sharedReads;
+   UINT_64  uniqueWrites, sharedWrites;
+};
+
+/**
+ * @ingroup LoopSolver
+ * @brief   Loop body, trip count and remainder chosen for one cell
+ *
+ * The body counts exclude the EXTRA_LOOP_OPS loop overhead, which is part of loopSize.
+ */
+struct LoopShape
+{
+   BOOL     useLoops;
+
+   UINT_32  loopSize;
+   UINT_32  numIters;
+   UINT_32  remainder;
+
+   UINT_64  numMemOps;
+   UINT_64  numLoadOps;
+   UINT_64  numStoreOps;
+   UINT_64  numIntegerOps;
+   UINT_64  numFloatOps;
+
+   UINT_32  remMemOps;
+   UINT_32  remIntOps;
+   UINT_32  remFltOps;
+
+   double   cost;
+};
+
+/**
+ * @ingroup LoopSolver
+ * @brief   Loop-shape solver
+ *
+ */
+class LoopSolver
+{
+   public:
+      /* Constructor */
+      LoopSolver(UINT_32 codeBudgetIn = 0, double objectiveIn = 0.5);
+
+      /* Functions */
+      LoopShape            solve(const LoopDemand &demand, BOOL allowLoops) const;
+
+      static void          splitMemory(const LoopDemand &demand, UINT_64 numMemOps, UINT_64 &numLoadOps, UINT_64 &numStoreOps);
+
+      UINT_32              get_codeBudget(void) const { return codeBudget; }
+      double               get_objective(void) const { return objective; }
+
+   private:
+      UINT_32  codeBudget;                                           //most instructions a cell may emit (0 -- no limit)
+      double   objective;                                            //1 -- code size only, 0 -- mix fidelity only
+
+      BOOL                 evaluate(const LoopDemand &demand, UINT_32 loopSize, LoopShape &shape) const;
+      LoopShape            straightLine(const LoopDemand &demand) const;
+};
+
+#endif
@@ -0,0 +1,265 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the implementation for the MIPS backend.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Implementation: MipsBackend
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <iomanip>
+
+#include "MipsBackend.h"
+
+std::string MipsBackend::intVariable(RegType registerIn) const
+{
+   return Instruction::getIntVariable(registerIn);
+}
+
+std::string MipsBackend::fpVariable(RegType registerIn) const
+{
+   return Instruction::getFPVariable(registerIn);
+}
+
+/**
+ * @ingroup Backend
+ * @brief   SESC recognizes transactions by these magic opcodes
+ *
+ * @param outputFile
+ */
+void MipsBackend::writeTransactionMacros(std::ostream &outputFile)
+{
+   outputFile << "#define BEGIN_TRANSACTION(n) do {\t\t\t\\\n";
+   outputFile << "        __asm__ __volatile__ (\".word 0x70000000+\" #n);\t\\\n";
+   outputFile << "} while (0)\n\n";
+
+   outputFile << "#define COMMIT_TRANSACTION(n) do {\t\t\t\\\n";
+   outputFile << "        __asm__ __volatile__ (\".word 0x7C000000+\" #n);\t\\\n";
+   outputFile << "} while (0)\n";
+}
+
+void MipsBackend::writeSharedBase(std::ostream &outputFile)
+{
+   outputFile << "register int s_data_out_int asm(\"22\");\n";
+//    outputFile << "float* shared_memFloat;\n";
+//    outputFile << "register int s_data_out_float asm(\"23\");\n";
+}
+
+/**
+ * @ingroup Backend
+ * @brief   Pins the working values to the registers the instruction streams name
+ *
+ * @param outputFile
+ */
+void MipsBackend::writeRegisters(std::ostream &outputFile)
+{
+   outputFile << "   register int r_out_t0 asm(\"8\");\n";
+   outputFile << "   register int r_out_t1 asm(\"9\");\n";
+   outputFile << "   register int r_out_t2 asm(\"10\");\n";
+   outputFile << "   register int r_out_t3 asm(\"11\");\n";
+   outputFile << "   register int r_out_t4 asm(\"12\");\n";
+   outputFile << "   register int r_out_t5 asm(\"13\");\n";
+
+   outputFile << "   register int r_out_s0 asm(\"16\");\n";
+   outputFile << "   register int r_out_s1 asm(\"17\");\n";
+   outputFile << "   register int r_out_s2 asm(\"18\");\n";
+   outputFile << "   register int r_out_s3 asm(\"19\");\n";
+   outputFile << "   register int r_out_s4 asm(\"20\");\n";
+   outputFile << "   register int r_out_s5 asm(\"21\");\n";
+
+   outputFile << "   register int r_out_f2 asm(\"$f2\");\n";
+   outputFile << "   register int r_out_f4 asm(\"$f4\");\n";
+   outputFile << "   register int r_out_f6 asm(\"$f6\");\n";
+   outputFile << "   register int r_out_f8 asm(\"$f8\");\n";
+   outputFile << "   register int r_out_f10 asm(\"$f10\");\n";
+   outputFile << "   register int r_out_f12 asm(\"$f12\");\n";
+
+   outputFile << "\n   register int data_out_int asm(\"20\");\n";
+   outputFile << "   register int data_out_float asm(\"21\");\n";
+
+   //loop counters -- $22 holds the shared base, so the nest counter takes $24
+   outputFile << "   register int cell_counter asm(\"23\");\t\t//inner loop counter\n";
+   outputFile << "   register int block_counter asm(\"14\");\t\t//outer loop counter\n";
+   outputFile << "   register int nest_counter asm(\"24\");\t\t//nested cell loop counter\n";
+}
+
+/**
+ * @ingroup Backend
+ * @brief   Instructions are written individually
+ *
+ * @param outputFile
+ * @param instructionIn
+ * @param operandList
+ */
+void MipsBackend::writeInstruction(std::ostream &outputFile, Instruction *instructionIn, OperandList &operandList)
+{
+   /* Variables */
+
+   /* Processes */
+   outputFile << "   __asm__ __volatile__ ( \"";
+
+   if(instructionIn->get_opCode() == iALU)
+   {
+//       outputFile << "add";
+      outputFile << "xor";
+      if(operandList.rd != "")
+         outputFile << " "  << operandList.rd;
+      if(operandList.rs != "")
+         outputFile << ", " << operandList.rs;
+      if(operandList.rt != "")
+         outputFile << ", " << operandList.rt;
+
+      outputFile << std::setw(6) << "\"\t :";
+   }
+   else if(instructionIn->get_opCode() == iMult || instructionIn->get_opCode() == iDiv)
+   {
+      //the three-operand div macro checks for zero; div with $0 as destination is the bare instruction
+      if(instructionIn->get_opCode() == iMult)
+         outputFile << "mult " << operandList.rs << ", " << operandList.rt;
+      else
+         outputFile << "div $0, " << operandList.rs << ", " << operandList.rt;
+      outputFile << "\\n\\tmflo " << operandList.rd;
+
+      outputFile << std::setw(6) << "\"\t :";
+
+      if(operandList.clobberList.size() > 0)
+         operandList.clobberList = operandList.clobberList + ", ";
+      operandList.clobberList = operandList.clobberList + "\"hi\", \"lo\"";
+   }
+   else if(instructionIn->get_opCode() == fpMult || instructionIn->get_opCode() == fpDiv)
+   {
+      outputFile << (instructionIn->get_opCode() == fpMult ? "mul.d" : "div.d");
+      outputFile << " " << operandList.rd << ", " << operandList.rs << ", " << operandList.rt;
+
+      outputFile << std::setw(6) << "\"\t :";
+   }
+   else if(instructionIn->get_opCode() == fpALU)
+   {
+      outputFile << "add.d";
+      if(operandList.rd != "")
+         outputFile << " "  << operandList.rd;
+      if(operandList.rs != "")
+         outputFile << ", " << operandList.rs;
+      if(operandList.rt != "")
+         outputFile << ", " << operandList.rt;
+
+      outputFile << std::setw(6) << "\"\t :";
+   }
+   else if(instructionIn->get_opCode() == iLoad)
+   {
+      outputFile << "lw";
+      if(operandList.rd != "")
+         outputFile << " "  << operandList.rd;
+      if(operandList.rs != "")
+         outputFile << ", " << operandList.rs;
+      if(operandList.rt != "")
+         outputFile << ", " << operandList.rt;
+
+      outputFile << std::setw(6) << "\"\t :";
+   }
+   else if(instructionIn->get_opCode() == iBJ && instructionIn->get_subCode() == BJCond)
+   {
+      //taken skips the nop, so either outcome can be mispredicted
+      outputFile << "bnez " << operandList.rs << ", 1f\\n\\tnop\\n1:";
+
+      outputFile << std::setw(6) << "\"\t :";
+   }
+   else if(instructionIn->get_opCode() == iBJ)
+   {
+      outputFile << "b";
+      if(operandList.rd != "")
+         outputFile << " "  << operandList.rd;
+      if(operandList.rs != "")
+         outputFile << ", " << operandList.rs;
+      if(operandList.rt != "")
+         outputFile << ", " << operandList.rt;
+
+      outputFile << std::setw(6) << "\"\t :";
+   }
+
+   if(instructionIn->get_opCode() == iStore)
+   {
+      outputFile << "sw";
+      if(operandList.rd != "")
+         outputFile << " "  << operandList.rd;
+      if(operandList.rs != "")
+         outputFile << ", " << operandList.rs;
+      if(operandList.rt != "")
+         outputFile << ", " << operandList.rt;
+
+      outputFile << std::setw(6) << "\"\t :";
+
+      outputFile << " \"=" << operandList.rt_variable;
+
+      outputFile << " :";
+      outputFile << " \""  << operandList.rd_variable;
+   }
+   else
+   {
+      if(operandList.rd != "" && instructionIn->get_opCode() != iBJ)
+         outputFile << " \"=" << operandList.rd_variable;
+
+      outputFile << " :";
+      if(operandList.rs != "" && operandList.rs_variable != "")
+         outputFile << " \""  << operandList.rs_variable;
+      if(operandList.rt != "" && operandList.rs == "")
+         outputFile << " \""  << operandList.rt_variable;
+      else if(operandList.rt != "")
+         outputFile << ", \"" << operandList.rt_variable;
+   }
+
+   if(operandList.clobberList.size() > 0)
+      outputFile << " : " << operandList.clobberList;
+
+   outputFile << " );";
+
+   outputFile << std::endl;
+}
+
+void MipsBackend::writeLabel(std::ostream &outputFile, const std::string &label)
+{
+   outputFile << "   __asm__ __volatile__ (\"" << label << ":\");";
+   outputFile << "\n";
+}
+
+/**
+ * @ingroup Backend
+ *
+ * @param outputFile
+ * @param counter
+ * @param value Zero or the negative starting count of a nested loop
+ */
+void MipsBackend::writeCounterReset(std::ostream &outputFile, const std::string &counter, INT_32 value)
+{
+   std::string operands = ": \"=r\"(" + counter + ") );";
+
+   if(value == 0)
+      outputFile << "   __asm__ __volatile__ ( \"move %0, $0\"" << std::setw(21 + counter.size()) << operands << "\n";
+   else
+      outputFile << "   __asm__ __volatile__ ( \"addi %0, $0, " << value << "\"" << std::setw(29 + counter.size()) << operands << "\n";
+}
+
+/**
+ * @ingroup Backend
+ * @brief   Increments counter and branches back to label while it is below iterations
+ *
+ * @param outputFile
+ * @param counter
+ * @param iterations Must fit the signed 16-bit slti immediate
+ * @param label
+ */
+void MipsBackend::writeLoopBranch(std::ostream &outputFile, const std::string &counter, UINT_32 iterations, const std::string &label)
+{
+   std::string increment = ": \"=r\"(" + counter + ") :\"r\"(" + counter + ") );";
+   std::string compare = ": \"=r\"(r_out_t0) :\"r\"(" + counter + ") );";
+
+   outputFile << "   __asm__ __volatile__ ( \"addi %0, %1, 1\"" << std::setw(37 + counter.size()) << increment << "\n";
+   outputFile << "   __asm__ __volatile__ ( \"slti %0, %1, " << iterations << "\"" << std::setw(33 + counter.size()) << compare << "\n";
+   outputFile << "   __asm__ __volatile__ ( \"bne  %0, $0, " << label << "\" : :\"r\"(r_out_t0) );\n";
+}
@@ -0,0 +1,50 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the interface for the MIPS backend.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Interface: MipsBackend
+ * MIPS inline assembly for SESC. Every value lives in a fixed register and the loops
+ * are closed with addi/slti/bne.
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MIPS_BACKEND_H
+#define MIPS_BACKEND_H
+
+#include "Backend.h"
+
+/**
+ * @ingroup Backend
+ * @brief   MIPS/SESC writer
+ *
+ */
+class MipsBackend : public Backend
+{
+   public:
+      /* Functions */
+      std::string          get_name(void) const { return "mips"; }
+      std::string          get_addressType(void) const { return "int"; }
+      BOOL                 get_sharedBaseInRegister(void) const { return 1; }
+
+      std::string          intVariable(RegType registerIn) const;
+      std::string          fpVariable(RegType registerIn) const;
+
+      void                 writeTransactionMacros(std::ostream &outputFile);
+      void                 writeSharedBase(std::ostream &outputFile);
+      void                 writeRegisters(std::ostream &outputFile);
+
+      void                 writeInstruction(std::ostream &outputFile, Instruction *instructionIn, OperandList &operandList);
+      void                 writeLabel(std::ostream &outputFile, const std::string &label);
+
+      void                 writeCounterReset(std::ostream &outputFile, const std::string &counter, INT_32 value);
+      void                 writeLoopBranch(std::ostream &outputFile, const std::string &counter, UINT_32 iterations, const std::string &label);
+};
+
+#endif
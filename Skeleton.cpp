@@ -13,6 +13,8 @@
 /////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+
 #include "Skeleton.h"
 
 /**
@@ -20,7 +22,8 @@
  */
 Skeleton::Skeleton ( )
 {
-  Skeleton ( 0 );
+  this->numThreads = 0;
+  this->configuration = 0;
 }
 
 /**
@@ -31,6 +34,8 @@ Skeleton::Skeleton ( )
 Skeleton::Skeleton ( unsigned int numThreads )
 {
   this->numThreads = numThreads;
+  this->configuration = 0;
+  this->store.reset ( new SkeletonStore ( numThreads ) );
 
   for ( unsigned int i = 0; i < numThreads; i++ )
   {
@@ -49,6 +54,7 @@ Skeleton::Skeleton ( unsigned int numThreads, Config* cf )
 {
   this->numThreads = numThreads;
   this->configuration = cf;
+  this->store.reset ( new SkeletonStore ( numThreads ) );
 
   for ( unsigned int i = 0; i < numThreads; i++ )
   {
@@ -65,7 +71,63 @@ Skeleton::Skeleton ( unsigned int numThreads, Config* cf )
 Skeleton::Skeleton(const Skeleton &objectIn)
 {
    numThreads = objectIn.numThreads;
+   configuration = objectIn.configuration;
    thread = objectIn.thread;
+   store = objectIn.store;
+}
+
+/**
+ * @ingroup Skeleton
+ * 
+ * @param objectIn Skeleton to exchange contents with
+ *
+ * Hands the cell lists over without copying them; used to pass ownership between stages.
+ */
+void Skeleton::swap ( Skeleton &objectIn )
+{
+  std::swap ( numThreads, objectIn.numThreads );
+  std::swap ( configuration, objectIn.configuration );
+  thread.swap ( objectIn.thread );
+  store.swap ( objectIn.store );
+}
+
+/**
+ * @ingroup Skeleton
+ * 
+ * Drops every cell and conflict pair and empties the per-thread lists. The thread count is kept.
+ */
+void Skeleton::releaseCells ( )
+{
+  for ( unsigned int i = 0; i < thread.size(); i++ )
+    deque < Cell * > ().swap ( thread[ i ] );
+
+  store.reset ( );
+}
+
+/**
+ * @ingroup Skeleton
+ * 
+ * @return Store holding this skeleton's cells
+ */
+SkeletonStore * Skeleton::get_store ( )
+{
+  return store.get ( );
+}
+
+/**
+ * @ingroup Skeleton
+ * 
+ * @param n 
+ *
+ * Rebuilds thread n's cell list from the store; call once the thread's cells are all in place.
+ */
+void Skeleton::linkThread ( unsigned int n )
+{
+  I( n < numThreads );
+
+  thread[ n ].clear ( );
+  for ( unsigned int x = 0; x < store->getNumCells ( n ); x++ )
+    thread[ n ].push_back ( store->getCell ( n, x ) );
 }
 
 /**
@@ -78,6 +140,21 @@ unsigned int Skeleton::getNumThreads ( )
   return numThreads;
 }
 
+/**
+ * @ingroup Skeleton
+ * 
+ * @return Total number of cells
+ */
+unsigned int Skeleton::getNumCells ( )
+{
+  unsigned int numCells = 0;
+
+  for ( unsigned int i = 0; i < thread.size(); i++ )
+    numCells += thread[ i ].size();
+
+  return numCells;
+}
+
 /**
  * @ingroup Skeleton
  * 
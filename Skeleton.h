@@ -18,8 +18,10 @@
 #define SKELETON_H
 
 #include <deque>
+#include <boost/shared_ptr.hpp>
 
 #include "Cell.h"
+#include "SkeletonStore.h"
 #include "Config.h"
 #include "utilities/nanassert.h"
 
@@ -41,17 +43,25 @@ public:
          Skeleton(const Skeleton &objectIn);
 
          unsigned int        getNumThreads ( );                                        // Return number of instructions
+         unsigned int        getNumCells ( );                                          // Return number of cells across all threads
          deque < Cell * >  * getThread ( unsigned int );                               // Get the deque of cells for a thread
          bool                setThread ( deque < Cell * >  *cell, unsigned int n );    // Set the deque of cells for a thread
 
          deque < deque < Cell * > > & get_threadList(void);
 
+         void                swap ( Skeleton &objectIn );                              // Exchange contents without copying
+         void                releaseCells ( );                                         // Delete all cells, keep the thread count
+
+         SkeletonStore     * get_store ( );                                            // Backing storage for cells and conflicts
+         void                linkThread ( unsigned int n );                            // Point thread n's deque at its stored cells
+
 
 protected:
 
          Config*                       configuration;
          unsigned int                  numThreads;                                     // Total number of threads
          deque < deque < Cell * > >    thread;
+         boost::shared_ptr < SkeletonStore > store;                                    // Shared by copies, like the cells themselves were
 
 };
 
@@ -0,0 +1,121 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the implementation for the SkeletonStore object.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Implementation: SkeletonStore
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SkeletonStore.h"
+#include "utilities/nanassert.h"
+
+/**
+ * @ingroup SkeletonStore
+ *
+ * @param numThreads
+ */
+SkeletonStore::SkeletonStore(UINT_32 numThreads) : threadCells(numThreads)
+{
+}
+
+/**
+ * @ingroup SkeletonStore
+ * @brief   Replaces a thread's cells with numCells default cells
+ *
+ * @param threadID
+ * @param numCells
+ * @return Pointer to the first cell
+ */
+Cell *SkeletonStore::allocateCells(THREAD_ID threadID, UINT_32 numCells)
+{
+   I(threadID < threadCells.size());
+
+   std::vector< Cell > (numCells).swap(threadCells[threadID]);
+
+   return numCells ? &threadCells[threadID][0] : 0;
+}
+
+/**
+ * @ingroup SkeletonStore
+ * @brief   Adds a copy of cellIn to the end of a thread's cells
+ *
+ * @param threadID
+ * @param cellIn
+ * @return Index of the new cell
+ */
+UINT_32 SkeletonStore::appendCell(THREAD_ID threadID, const Cell &cellIn)
+{
+   I(threadID < threadCells.size());
+
+   threadCells[threadID].push_back(cellIn);
+
+   return threadCells[threadID].size() - 1;
+}
+
+/**
+ * @ingroup SkeletonStore
+ * @brief   Cell owned by the store but not tied to a thread's array
+ */
+Cell *SkeletonStore::newCell(void)
+{
+   looseCells.push_back(Cell());
+
+   return &looseCells.back();
+}
+
+Cell *SkeletonStore::getCell(THREAD_ID threadID, UINT_32 index)
+{
+   I(threadID < threadCells.size());
+   I(index < threadCells[threadID].size());
+
+   return &threadCells[threadID][index];
+}
+
+UINT_32 SkeletonStore::getNumCells(THREAD_ID threadID) const
+{
+   I(threadID < threadCells.size());
+
+   return threadCells[threadID].size();
+}
+
+UINT_32 SkeletonStore::getNumThreads(void) const
+{
+   return threadCells.size();
+}
+
+/**
+ * @ingroup SkeletonStore
+ * @brief   Appends one pair to the flat conflict array
+ *
+ * @param pairIn
+ */
+void SkeletonStore::pushConflict(const CONFLICT_PAIR &pairIn)
+{
+   conflicts.push_back(pairIn);
+}
+
+UINT_32 SkeletonStore::getNumConflicts(void) const
+{
+   return conflicts.size();
+}
+
+/**
+ * @ingroup SkeletonStore
+ *
+ * @param offset Index of the first pair
+ * @param count
+ * @return View of conflicts[offset, offset + count)
+ */
+ConflictRange SkeletonStore::getConflictRange(UINT_32 offset, UINT_32 count) const
+{
+   I(offset + count <= conflicts.size());
+
+   return ConflictRange(&conflicts, offset, count);
+}
@@ -0,0 +1,61 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the interface for the SkeletonStore object.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Interface: SkeletonStore
+ * Contiguous backing storage for a Skeleton: one cell array per thread and a single
+ * flat array of conflict pairs shared by every cell. The per-thread cell deques in the
+ * Skeleton point into this store.
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SKELETON_STORE_H
+#define SKELETON_STORE_H
+
+#include <vector>
+#include <deque>
+
+#include "param_types.h"
+#include "Cell.h"
+#include "ConflictRange.h"
+
+/**
+ * @ingroup SkeletonStore
+ * @brief   Cell and conflict-pair storage
+ *
+ * Pointers returned by allocateCells() stay valid until the same thread is allocated
+ * or appended to again; pointers from newCell() stay valid for the life of the store.
+ */
+class SkeletonStore
+{
+   public:
+      /* Constructor */
+      SkeletonStore(UINT_32 numThreads);
+
+      /* Functions */
+      Cell *               allocateCells(THREAD_ID threadID, UINT_32 numCells);
+      UINT_32              appendCell(THREAD_ID threadID, const Cell &cellIn);
+      Cell *               newCell(void);
+
+      Cell *               getCell(THREAD_ID threadID, UINT_32 index);
+      UINT_32              getNumCells(THREAD_ID threadID) const;
+      UINT_32              getNumThreads(void) const;
+
+      void                 pushConflict(const CONFLICT_PAIR &pairIn);
+      UINT_32              getNumConflicts(void) const;
+      ConflictRange        getConflictRange(UINT_32 offset, UINT_32 count) const;
+
+   private:
+      std::vector< std::vector< Cell > >  threadCells;
+      std::deque< Cell >                  looseCells;                    //cells added after the skeleton is built (e.g. loop markers)
+      std::vector< CONFLICT_PAIR >        conflicts;
+};
+
+#endif
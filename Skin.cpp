@@ -14,21 +14,29 @@
 /////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "Skin.h"
+#include "Stats.h"
+
+#include <map>
+#include <sstream>
+#include <iomanip>
 
 /**
  * @ingroup Skin
  * @brief Default constructor
  */
-Skin::Skin() : matchID(0), Skeleton()
+Skin::Skin() : matchID(0), config(0), Skeleton()
 {
 }
 
 /**
  * @ingroup Skin
  * @brief Constructor
+ *
+ * @note Takes over the cells of skeletonIn; skeletonIn is left empty
  */
-Skin::Skin(Skeleton &skeletonIn) : matchID(0), Skeleton(skeletonIn)
+Skin::Skin(Skeleton &skeletonIn) : matchID(0), config(0), Skeleton()
 {
+   Skeleton::swap(skeletonIn);
 }
 
 /**
@@ -37,10 +45,47 @@ Skin::Skin(Skeleton &skeletonIn) : matchID(0), Skeleton(skeletonIn)
  */
 Skin::~Skin()
 {
-//    for(std::deque< Instruction * >::iterator instructionList_it = instructionList.begin(); instructionList_it != instructionList.end(); instructionList_it++)
-//    {
-//       delete (*instructionList_it);
-//    }
+   for(THREAD_ID threadID = 0; threadID < perThread_instructionList.size(); threadID++)
+      releaseInstructions(threadID);
+
+   releaseCells();
+}
+
+/**
+ * @ingroup Skin
+ * @brief Exchange the cells, instruction streams and configuration with another Skin
+ *
+ * @param skinIn
+ */
+void Skin::swap(Skin &skinIn)
+{
+   Skeleton::swap(skinIn);
+   perThread_instructionList.swap(skinIn.perThread_instructionList);
+   perThread_numCells.swap(skinIn.perThread_numCells);
+   std::swap(config, skinIn.config);
+   std::swap(matchID, skinIn.matchID);
+}
+
+/**
+ * @ingroup Skin
+ * @brief Delete a thread's instruction stream once it is no longer needed
+ *
+ * @param threadID
+ */
+void Skin::releaseInstructions(THREAD_ID threadID)
+{
+   std::deque< Instruction * > *instructionList = perThread_instructionList[threadID];
+
+   if(instructionList == 0)
+      return;
+
+   for(std::deque< Instruction * >::iterator instructionList_it = instructionList->begin(); instructionList_it != instructionList->end(); instructionList_it++)
+   {
+      delete (*instructionList_it);
+   }
+
+   delete instructionList;
+   perThread_instructionList[threadID] = 0;
 }
 
 UINT_32 Skin::updateConfig(Config *config)
@@ -49,6 +94,22 @@ UINT_32 Skin::updateConfig(Config *config)
    return 1;
 }
 
+/**
+ * @ingroup Skin
+ * @brief Read-only view of a thread's instruction stream
+ *
+ * @param threadID
+ * @return The stream, or 0 if it has not been built or was already released
+ */
+const std::deque< Instruction * > *Skin::getInstructionList(THREAD_ID threadID) const
+{
+   if(threadID >= perThread_instructionList.size())
+      return 0;
+
+   return perThread_instructionList[threadID];
+}
+//END getInstructionList
+
 /**
  * @ingroup Skin
  * 
@@ -75,20 +136,69 @@ void Skin::spinalColumn(void)
    UINT_64  sharedReads, uniqueReads;
    UINT_64  sharedWrites, uniqueWrites;
 
+   UINT_32  codeBudget = 0;                                       //most instructions a looped cell may emit (0 -- no limit)
+   double   loopObjective = 0.5;                                  //1 -- smallest code, 0 -- closest instruction mix
+
+   float    longLatencyMix[4] = { 0.0, 0.0, 0.0, 0.0 };           //int mult, int div, fp mult, fp div for cells without their own
+
    THREAD_CELL_DEQUEP cellList;
    Instruction *instruction;
 
    /* Processes */
+   if(config != 0 && config->keyExists("Global", "longLatencyMix"))
+   {
+      std::deque< float > shares = config->readDeque< float >("Global", "longLatencyMix");
+
+      if(shares.size() != 4 || shares[0] < 0 || shares[1] < 0 || shares[2] < 0 || shares[3] < 0 || shares[0] + shares[1] > 1.0 || shares[2] + shares[3] > 1.0)
+      {
+         std::cerr << "Fatal Error: longLatencyMix takes four shares (int mult, int div, fp mult, fp div) and each pair must sum to at most 1" << std::endl;
+         exit(1);
+      }
+
+      for(UINT_32 share = 0; share < 4; share++)
+         longLatencyMix[share] = shares[share];
+   }
+
+   if(config != 0 && config->keyExists("Global", "loopCodeBudget"))
+      codeBudget = config->read<unsigned int>("Global", "loopCodeBudget");
+
+   if(config != 0 && config->keyExists("Global", "loopObjective"))
+      loopObjective = config->read<double>("Global", "loopObjective");
+
+   LoopSolver loopSolver(codeBudget, loopObjective);
+
    std::cout << "Assembling spine for thread ";
    for(UINT_32 threadID = 0; threadID < numThreads; threadID++)
    {
       std::cout << threadID << "..." << std::flush;
+      Stats::beginStage("spinalColumn", threadID);
 
       std::deque< Instruction * > *instructionList = new std::deque< Instruction * > ();
 
       blockLoop = blockLoopCount = 0;
       cellList = getThread(threadID);
 
+      //register dependences of cells without their own target -- 0 keeps the random registers
+      std::string threadRegion = "Thread" + Instruction::IntToString(threadID);
+      UINT_32 threadDistance = 0;
+      if(config != 0 && config->keyExists(threadRegion, "dependencyDistance"))
+         threadDistance = config->read<unsigned int>(threadRegion, "dependencyDistance");
+      else if(config != 0 && config->keyExists("Global", "dependencyDistance"))
+         threadDistance = config->read<unsigned int>("Global", "dependencyDistance");
+
+      //share of integer ALU operations that become conditional branches
+      float threadBranches = 0.0;
+      if(config != 0 && config->keyExists(threadRegion, "branchFrequency"))
+         threadBranches = config->read<float>(threadRegion, "branchFrequency");
+      else if(config != 0 && config->keyExists("Global", "branchFrequency"))
+         threadBranches = config->read<float>("Global", "branchFrequency");
+
+      if(threadBranches < 0.0 || threadBranches > 1.0)
+      {
+         std::cerr << "Fatal Error: branchFrequency must be between 0 and 1\nThread: " << threadID << std::endl;
+         exit(1);
+      }
+
       #if defined(DEBUG)
       std::cout << "\nCell Count (" << threadID << "):  " << cellList->size() << "\n";
       #endif
@@ -192,287 +302,45 @@ void Skin::spinalColumn(void)
          I(uniqueReads  >= sharedReads);
          I(uniqueWrites >= sharedWrites);
 
-         /* Variables -- Loop Body Only */
-         UINT_64  totalIns = numMemOps + numFloatOps + numIntegerOps;
-         float    pctMem = float(numMemOps) / totalIns;
-         float    pctFlt = float(numFloatOps) / totalIns;
-         float    pctInt = float(numIntegerOps) / totalIns;
-
-         float    minMem = uniqueReads + uniqueWrites;
-         float    minTotal = minMem / pctMem;
-         float    minFlt = pctFlt * minTotal;
-         float    minInt = pctInt * minTotal;
-
-         //loops require 3 integer ALU ops and 1 branch per cell
-         if(minInt < EXTRA_LOOP_OPS && useLoops == 1)
-         {
-            minInt = 4.0;
-
-            if(pctInt == 0)
-               pctInt = float(minInt) / totalIns;
+         //pick the body size, trip count and remainder -- cells whose memory outlay is specified are
+         //written straight-line since their looping is managed independantly
+         LoopDemand demand = {numMemOps, numIntegerOps, numFloatOps, uniqueReads, sharedReads, uniqueWrites, sharedWrites};
+         LoopShape shape = loopSolver.solve(demand, useLoops == 1 && (*cellIterator)->getConflictModel() != Specified);
 
-            minTotal = minInt / pctInt;
-            minMem = pctMem * minTotal;
-            minFlt = pctFlt * minTotal;
+         useLoops = shape.useLoops;
+         numMemOps = shape.numMemOps;
+         numFloatOps = shape.numFloatOps;
+         numIntegerOps = shape.numIntegerOps;
+         numLoadOps = shape.numLoadOps;
+         numStoreOps = shape.numStoreOps;
 
-            minTotal = minTotal - 1.0;
-         }
+         INT_32 loopSize = shape.loopSize;
+         INT_32 numIters = shape.numIters;
+         INT_32 remainder = shape.remainder;
 
-         INT_32 loopSize = roundFloat(minTotal);
-         INT_32 numIters = totalIns / loopSize;
-         INT_32 remainder = totalIns % loopSize;
+         //slti only takes a signed 16-bit immediate, so long cells split their iterations over two counters:
+         //the inner loop runs innerIters times per outer pass and the first pass picks up the extra iterations
+         UINT_32 outerIters = 1;
+         UINT_32 extraIters = 0;
 
-         //If loops are enabled, there are additional checks that need to happen
-         if(useLoops == 1 && totalIns >= (2 * loopSize))
-            useLoops = 1;
-         else
-            useLoops = 0;
-
-         //Check to make sure that the branch target is withing range
-         if(useLoops == 1 && loopSize > _16_BIT_RANGE)
+         if(useLoops == 1 && numIters > MAX_LOOP_ITERATIONS)
          {
-            std::cerr << "\n\t\t               ---LOOP FAILURE---" << "\n";
-            std::cerr << "\t\t   ---Loop Size Exceeded Addressable Range---" << std::endl;
-            exit(0);
-         }
-
-         //disable loops if the memory outlay is specified -- looping managed independantly
-         if((*cellIterator)->getConflictModel() == Specified)
-            useLoops = 0;
+            outerIters = (numIters + MAX_LOOP_ITERATIONS - 1) / MAX_LOOP_ITERATIONS;
 
-         if(useLoops == 1)
-         {
-            numMemOps = roundFloat(minMem);
-            numFloatOps = roundFloat(minFlt);
-            numIntegerOps = roundFloat(minInt) - EXTRA_LOOP_OPS;
-         }
-
-         //ensure that the number of R/W operations is correct
-         if(uniqueWrites > 0 && uniqueReads > 0 && sharedReads < uniqueReads && sharedWrites < uniqueWrites)
-         {
-            numLoadOps  = numMemOps * 5 / 7;
-            numStoreOps = numMemOps - numLoadOps;
-         }
-         else if(uniqueReads > 0 && sharedReads == uniqueReads)
-         {
-            numLoadOps = uniqueReads;
-            numStoreOps = numMemOps - numLoadOps;
-         }
-         else if(uniqueWrites > 0 && sharedWrites == uniqueWrites)
-         {
-            numStoreOps = uniqueWrites;
-            numLoadOps = numMemOps - numStoreOps;
-         }
-         else if(uniqueWrites > 0)
-         {
-            numLoadOps  = 0;
-            numStoreOps = numMemOps;
-         }
-         else if(uniqueReads > 0)
-         {
-            numStoreOps = 0;
-            numLoadOps  = numMemOps;
-         }
-         else
-         {
-            std::cerr << "Ow! -- R(" << uniqueReads << ") W(" << uniqueWrites << ")" << "\n";
-         }
-
-         if(numLoadOps < std::max(sharedReads, uniqueReads))
-         {
-            numLoadOps = std::max(sharedReads, uniqueReads);
-            numStoreOps = numMemOps - numLoadOps;
-         }
-         else if(numStoreOps < std::max(sharedWrites, uniqueWrites))
-         {
-            numStoreOps = std::max(sharedWrites, uniqueWrites);
-            numLoadOps = numMemOps - numStoreOps;
-         }
-
-         //recalculate based on instruction adjustments
-         loopSize = numMemOps + numFloatOps + numIntegerOps + EXTRA_LOOP_OPS;
-         numIters = roundFloat(totalIns) / loopSize;
-         remainder = roundFloat(totalIns) % loopSize;
-
-         //Check to make sure that the branch target is withing range
-         if(useLoops == 1 && loopSize > _16_BIT_RANGE)
-         {
-            std::cerr << "\n\t\t               ---LOOP FAILURE---" << "\n";
-            std::cerr << "\t\t   ---Loop Size Exceeded Addressable Range---" << std::endl;
-            exit(0);
-         }
-
-         //check for range (16 bit max immediate)
-         if(numIters > _16_BIT_RANGE)
-         {
-            std::cerr << "\nNumber of loop iterations exceeded range (" << _16_BIT_RANGE << "). Recalculating parameters.\n";
-            std::cerr << "NOTE: This is experimental and may produce cells too large to compile. It may also modify stride." << std::endl;
-
-            std::cerr << "LOOP SIZE:  " << loopSize;
-            std::cerr << "\tITERATIONS:  " << numIters;
-            std::cerr << "\tREMAINDER  : " << remainder;
-            std::cerr << "\n" << std::endl;
-
-            //recalculate based on loop adjustments
-            minTotal = (totalIns / float(_16_BIT_RANGE)) + 2.0;
-            minMem   = pctMem * minTotal;
-            minFlt   = pctFlt * minTotal;
-            minInt   = pctInt * minTotal;
-
-            numMemOps      = roundFloat(minMem);
-            numFloatOps    = roundFloat(minFlt);
-            numIntegerOps  = roundFloat(minInt) - EXTRA_LOOP_OPS;
-
-            //if the number of operations has changed then the number of R/W operations must be recalculated
-            if(uniqueWrites > 0 && uniqueReads > 0)
-            {
-               numLoadOps = numMemOps * 5 / 7;
-               numStoreOps = numMemOps - numLoadOps;
-            }
-            else if(uniqueWrites > 0)
-            {
-               numLoadOps = 0;
-               numStoreOps = numMemOps;
-            }
-            else if(uniqueReads > 0)
-            {
-               numStoreOps = 0;
-               numLoadOps = numMemOps;
-            }
-
-            if(numLoadOps < std::max(sharedReads, uniqueReads))
-            {
-               numLoadOps = std::max(sharedReads, uniqueReads);
-               numStoreOps = numMemOps - numLoadOps;
-            }
-            else if(numStoreOps < std::max(sharedWrites, uniqueWrites))
-            {
-               numStoreOps = std::max(sharedWrites, uniqueWrites);
-               numLoadOps = numMemOps - numStoreOps;
-            }
-
-            loopSize = numMemOps + numFloatOps + numIntegerOps + EXTRA_LOOP_OPS;
-            numIters = totalIns / loopSize;
-            remainder = totalIns % loopSize;
-
-            //Check to make sure that the branch target is withing range
-            if(useLoops == 1 && loopSize > _16_BIT_RANGE)
+            if(outerIters > MAX_LOOP_ITERATIONS)
             {
                std::cerr << "\n\t\t               ---LOOP FAILURE---" << "\n";
-               std::cerr << "\t\t   ---Loop Size Exceeded Addressable Range---" << std::endl;
+               std::cerr << "\t\t   ---Iterations Exceeded Nested Loop Range---" << std::endl;
                exit(0);
             }
-         }
-         //END Range check
 
-         //find remainder local minimum
-         //this algorithm attempts to minimize the number of remainder instructions -- reducing program size
-         if(useLoops == 1 && numIters > 1 && float(remainder) / float(loopSize) >= .65)
-         {
-            int newS = 0;
-            int oldS = 0;
-            int newR = 0;
-            int oldR = 0;
-            int newI = 0;
-            int oldI = 0;
-            unsigned int testMe = 0;
+            extraIters = numIters % outerIters;
+            numIters = numIters / outerIters;
 
-            #if defined(VERBOSE)
-            std::cout << "\n****Remainder:  " << float(remainder) << "\tSize:  " << float(loopSize) << "(" << minTotal << ")";
-            std::cout << "\tIters:  " << numIters << "\tPercent:  " << float(remainder) / float(loopSize) << std::endl;
-
-            std::cout << "***Old InsCount:  " << totalIns << "\tNew InsCount:  " << (numIters + 1) * loopSize;
-            std::cout << "\tNew LoopSz:  " << totalIns/(numIters + 1) << "\tNew Iters:  " << numIters + 1 << std::endl;
-
-            std::cout << "***MEM:  " << pctMem << "\tINT:  " << pctInt << "\tFLT:  " << pctFlt << std::endl;
+            #if defined(DEBUG)
+            std::cout << "   NESTED-" << outerIters << "x" << numIters << "+" << extraIters;
             #endif
-
-            do
-            {
-               if(testMe == 0)
-               {
-                  oldS = loopSize;
-                  oldI = numIters;
-                  oldR = remainder;
-                  testMe = 1;
-               }
-               else
-               {
-                  oldS = newS;
-                  oldI = newI;
-                  oldR = newR;
-               }
-
-               newS = oldS + 10;
-               newI = roundFloat(totalIns) / newS;
-               newR = roundFloat(totalIns) % newS;
-
-               #if defined(VERBOSE)
-               std::cout << "\tS -- " << oldS << "   " << newS << "\n";
-               std::cout << "\tI -- " << oldI << "   " << newI << "\n";
-               std::cout << "\tR -- " << oldR << "   " << newR << "\n";
-               #endif
-
-            }while(newR < oldR);
-
-            #if defined(VERBOSE)
-            std::cout << "+++NewRemainder(" << remainder << "):  " << oldR;
-            std::cout << "\tnewSize(" << loopSize << "):  " << oldS;
-            std::cout << "\tnewIters(" << numIters << "):  " << oldI << std::endl;
-            #endif
-
-            if(oldS >= minTotal + EXTRA_LOOP_OPS)
-            {
-               numMemOps = roundFloat(oldS * pctMem);
-               numFloatOps = roundFloat(oldS * pctFlt);
-               numIntegerOps = roundFloat(oldS * pctInt) - EXTRA_LOOP_OPS;
-
-               if(uniqueWrites > 0 && uniqueReads > 0)
-               {
-                  numLoadOps = numMemOps * 5 / 7;
-                  numStoreOps = numMemOps - numLoadOps;
-               }
-               else if(uniqueWrites > 0)
-               {
-                  numLoadOps = 0;
-                  numStoreOps = numMemOps;
-               }
-               else if(uniqueReads > 0)
-               {
-                  numStoreOps = 0;
-                  numLoadOps = numMemOps;
-               }
-               else
-               {
-                  std::cerr << "Ow! -- R(" << uniqueReads << ") W(" << uniqueWrites << ")" << "\n";
-               }
-
-               if(numLoadOps < std::max(sharedReads, uniqueReads))
-               {
-                  numLoadOps = std::max(sharedReads, uniqueReads);
-                  numStoreOps = numMemOps - numLoadOps;
-               }
-               else if(numStoreOps < std::max(sharedWrites, uniqueWrites))
-               {
-                  numStoreOps = std::max(sharedWrites, uniqueWrites);
-                  numLoadOps = numMemOps - numStoreOps;
-               }
-
-               //recalculate based on instruction adjustments
-               loopSize = numMemOps + numFloatOps + numIntegerOps + EXTRA_LOOP_OPS;
-               numIters = roundFloat(totalIns) / loopSize;
-               remainder = roundFloat(totalIns) % loopSize;
-
-               #if defined(VERBOSE)
-               std::cout << "\n@@@@Remainder:  " << float(remainder) << "\tSize:  " << float(loopSize) << "(" << minTotal << ")";
-               std::cout << "\tIters:  " << numIters << "\tPercent:  " << float(remainder) / float(loopSize) << std::endl;
-
-               std::cout << "@@@@Old Size:  " << roundFloat(totalIns) << "\tNew Size:  " << roundFloat(float(remainder) + float(loopSize) * numIters);
-               std::cout << "\tDiff:  " << roundFloat(totalIns) - roundFloat(float(remainder) + float(loopSize) * numIters) << std::endl;
-               #endif
-            }
          }
-         //END Finding Local Minimum
 
          #if defined(DEBUG)
          std::cout << "   LD-" << numLoadOps << "(S" << sharedReads << " - U" << uniqueReads << ")";
@@ -481,6 +349,8 @@ void Skin::spinalColumn(void)
             std::cout << " -H- ";
          else if((*cellIterator)->getConflictModel() == Random)
             std::cout << " -R- ";
+         else if((*cellIterator)->getConflictModel() == Zipf)
+            std::cout << " -Z- ";
          else
             std::cout << " -S- ";
          std::cout << "\n";
@@ -497,7 +367,13 @@ void Skin::spinalColumn(void)
          if(useLoops == 1)
          {
             instruction = new Instruction(iInitLoop);
-            instruction->set_subCode(CellLoop);
+            if(outerIters > 1)
+            {
+               instruction->set_subCode(NestedCellLoop);
+               instruction->set_immediate(extraIters);
+            }
+            else
+               instruction->set_subCode(CellLoop);
             tempInstructionList->push_back(instruction);
          }
 
@@ -507,6 +383,12 @@ void Skin::spinalColumn(void)
             instruction = new Instruction(iBeginTX);
             if((*cellIterator)->getConflictModel() == High)
                instruction->set_conflictModel(High);
+            else if((*cellIterator)->getConflictModel() == Zipf)
+            {
+               //Body reads the skew back from the immediate, in thousandths
+               instruction->set_conflictModel(Zipf);
+               instruction->set_immediate(INT_64((*cellIterator)->getConflictSkew() * 1000 + 0.5));
+            }
             tempInstructionList->push_back(instruction);
          }
 
@@ -514,7 +396,7 @@ void Skin::spinalColumn(void)
          if(useLoops == 1)
          {
             instruction = new Instruction(iBeginLoop);
-            instruction->set_subCode(CellLoop);
+            instruction->set_subCode(outerIters > 1 ? NestedCellLoop : CellLoop);
             tempInstructionList->push_back(instruction);
          }
 
@@ -550,25 +432,21 @@ void Skin::spinalColumn(void)
          if(useLoops == 1)
          {
             instruction = new Instruction(iEndLoop);
-            instruction->set_subCode(CellLoop);
+            if(outerIters > 1)
+            {
+               instruction->set_subCode(NestedCellLoop);
+               instruction->set_immediate(outerIters);
+            }
+            else
+               instruction->set_subCode(CellLoop);
             instruction->set_iterations(numIters);
             tempInstructionList->push_back(instruction);
 
             if(remainder > 0)
             {
-               UINT_32 remMemOps_ = roundFloat(remainder * pctMem);
-               UINT_32 remIntOps_ = roundFloat(remainder * pctInt);
-               UINT_32 remFltOps_ = roundFloat(remainder * pctFlt);
-
-               while(remMemOps_ + remIntOps_ + remFltOps_ > remainder)
-               {
-                  remIntOps_ = remIntOps_ - 1;
-               }
-
-               while(remMemOps_ + remIntOps_ + remFltOps_ < remainder)
-               {
-                  remIntOps_ = remIntOps_ + 1;
-               }
+               UINT_32 remMemOps_ = shape.remMemOps;
+               UINT_32 remIntOps_ = shape.remIntOps;
+               UINT_32 remFltOps_ = shape.remFltOps;
 
                //generate integer instructions
                for(UINT_32 insCount = 0; insCount < remIntOps_; insCount++)
@@ -635,12 +513,12 @@ void Skin::spinalColumn(void)
                randomizeInstructionStream(tempInstructionList, (*cellIterator)->getConflictModel(), (*cellIterator)->getCellType(), sharedReads, sharedWrites, useLoops);
 
             //if the layout is specified, loads and stores should be reordered
-            specifyMemory(tempInstructionList, (*cellIterator)->get_loadConflictList(), (*cellIterator)->get_storeConflictList());
+            specifyMemory(tempInstructionList, (*cellIterator)->get_loadConflicts(), (*cellIterator)->get_storeConflicts());
 
             //need to be sure that no load occurs before the first unique load and that no store occurs before the first unique store
-            prioritizeMemory(tempInstructionList, (*cellIterator)->get_loadConflictList(), (*cellIterator)->get_storeConflictList());
+            prioritizeMemory(tempInstructionList, (*cellIterator)->get_loadConflicts(), (*cellIterator)->get_storeConflicts());
 
-//             getDistanceList(tempInstructionList, (*cellIterator)->get_loadConflictList(), (*cellIterator)->get_storeConflictList(), conflictDistances);
+//             getDistanceList(tempInstructionList, (*cellIterator)->get_loadConflicts(), (*cellIterator)->get_storeConflicts(), conflictDistances);
 //             makeStrideLoops(tempInstructionList, conflictDistances);
          }
          else
@@ -656,6 +534,35 @@ void Skin::spinalColumn(void)
                randomizeInstructionStream(tempInstructionList, (*cellIterator)->getConflictModel(), (*cellIterator)->getCellType(), sharedReads, sharedWrites, useLoops);
          }
 
+         //multiplies and divides replace part of the ALU operations, spread evenly over loop body and remainder
+         if((*cellIterator)->getIntMultShare() > 0 || (*cellIterator)->getIntDivShare() > 0 || (*cellIterator)->getFPMultShare() > 0 || (*cellIterator)->getFPDivShare() > 0)
+            lengthenOperations(tempInstructionList, (*cellIterator)->getIntMultShare(), (*cellIterator)->getIntDivShare(), (*cellIterator)->getFPMultShare(), (*cellIterator)->getFPDivShare());
+         else if(longLatencyMix[0] > 0 || longLatencyMix[1] > 0 || longLatencyMix[2] > 0 || longLatencyMix[3] > 0)
+            lengthenOperations(tempInstructionList, longLatencyMix[0], longLatencyMix[1], longLatencyMix[2], longLatencyMix[3]);
+
+         //conditional branches take what is left of the integer ALU operations
+         if(threadBranches > 0.0)
+            conditionBranches(tempInstructionList, threadBranches);
+
+         //dependent loads are picked once the stream is in its final order
+         if((*cellIterator)->getChaseCount() > 0 && (*cellIterator)->getChaseLength() > 0)
+            chaseMemory(tempInstructionList, (*cellIterator)->getChaseCount(), (*cellIterator)->getChaseLength());
+
+         //registers follow the cell's dependence target; the rest are drawn in insertVertebrae
+         if((*cellIterator)->getDependencyDistance() > 0 || (*cellIterator)->getCriticalPath() > 0)
+            assignRegisters(tempInstructionList, (*cellIterator)->getDependencyDistance(), (*cellIterator)->getCriticalPath());
+         else if(threadDistance > 0)
+            assignRegisters(tempInstructionList, threadDistance, 0);
+
+         //a cell with its own access pattern leads with the marker -- after randomization so it stays first
+         if((*cellIterator)->getAccessPattern() != iSubInvalid)
+         {
+            instruction = new Instruction(iMemPattern);
+            instruction->set_subCode((*cellIterator)->getAccessPattern());
+            instruction->set_immediate((*cellIterator)->getAccessParameter());
+            tempInstructionList->push_front(instruction);
+         }
+
          //add a the branch instruction
          instruction = new Instruction(iBJ);
          tempInstructionList->push_back(instruction);
@@ -668,6 +575,8 @@ void Skin::spinalColumn(void)
 
       //add the stream to the per-thread list of instructions
       perThread_instructionList.push_back(instructionList);
+      perThread_numCells.push_back(cellList->size());
+      Stats::endStage(cellList->size(), instructionList->size());
 
       #if defined(VERBOSE)
       std::cout << "List Size:  " << instructionList->size() << "\n";
@@ -975,21 +884,21 @@ std::cout << "\n" << std::endl;
  * 
  * @note  Generates a sorted list containing the sizes of the areas between unique memory references
  * @param instructionList 
- * @param readConflictList 
- * @param writeConflictList 
+ * @param readConflicts 
+ * @param writeConflicts 
  * @param conflictDistances 
  */
-void Skin::getDistanceList(std::deque < Instruction * > *instructionList, std::list< CONFLICT_PAIR >* readConflictList, std::list< CONFLICT_PAIR >* writeConflictList, std::deque<UINT_32> *conflictDistances)
+void Skin::getDistanceList(std::deque < Instruction * > *instructionList, const ConflictRange &readConflicts, const ConflictRange &writeConflicts, std::deque<UINT_32> *conflictDistances)
 {
    /* Variables */
 
    /* Processes */
-   for(std::list< CONFLICT_PAIR >::const_iterator conflictList_it = readConflictList->begin(); conflictList_it != readConflictList->end(); conflictList_it++)
+   for(ConflictRange::const_iterator conflictList_it = readConflicts.begin(); conflictList_it != readConflicts.end(); conflictList_it++)
    {
       conflictDistances->push_back(conflictList_it->second);
    }
 
-   for(std::list< CONFLICT_PAIR >::const_iterator conflictList_it = writeConflictList->begin(); conflictList_it != writeConflictList->end(); conflictList_it++)
+   for(ConflictRange::const_iterator conflictList_it = writeConflicts.begin(); conflictList_it != writeConflicts.end(); conflictList_it++)
    {
       conflictDistances->push_back(conflictList_it->second);
    }
@@ -1030,6 +939,7 @@ void Skin::insertVertebrae(void)
    for(THREAD_ID threadID = 0; threadID < numThreads; threadID++)
    {
       std::cout << threadID << "..." << std::flush;
+      Stats::beginStage("insertVertebrae", threadID);
 
       count = 0;
       std::deque < Instruction * > *instructionList = perThread_instructionList[threadID];
@@ -1038,7 +948,11 @@ void Skin::insertVertebrae(void)
 
       for(instructionList_it = instructionList->begin(); instructionList_it != instructionList->end(); instructionList_it++)
       {
-         if((*instructionList_it)->get_opCode() == iALU)
+         //registers chosen for a dependence target are kept
+         if((*instructionList_it)->get_rd() != RegInvalid)
+            continue;
+
+         if((*instructionList_it)->is_intArithmetic())
          {
             count = count + 1;
 //             std::cout << "ALU " << count << "\n";
@@ -1051,7 +965,7 @@ void Skin::insertVertebrae(void)
 //             std::cout << "RT:  " << (*instructionList_it)->get_rt() << "    ";
 //             std::cout << "RD:  " << (*instructionList_it)->get_rd() << "\n";
          }
-         else if((*instructionList_it)->get_opCode() == fpALU)
+         else if((*instructionList_it)->is_fpArithmetic())
          {
             count = count + 1;
 //             std::cout << "FP " << count << "\n";
@@ -1088,9 +1002,18 @@ void Skin::insertVertebrae(void)
          }
 
       }
+
+      Stats::endStage(perThread_numCells[threadID], instructionList->size());
    }
 
    std::cout << "COMPLETE" << std::endl;
+
+   //how much parallelism the chosen registers leave, per thread
+   if(config != 0 && config->keyExists("Global", "ilpReport") && config->read<BOOL>("Global", "ilpReport") == 1)
+   {
+      for(THREAD_ID threadID = 0; threadID < numThreads; threadID++)
+         reportILP(threadID, perThread_instructionList[threadID]);
+   }
 }
 //END insertVertebrae
 
@@ -1114,6 +1037,7 @@ void Skin::synchronize(void)
    for(THREAD_ID threadID = 0; threadID < numThreads; threadID++)
    {
       std::cout << threadID << "..." << std::flush;
+      Stats::beginStage("synchronize", threadID);
 
       std::deque < Instruction * > *instructionList = perThread_instructionList[threadID];
 
@@ -1198,6 +1122,8 @@ void Skin::synchronize(void)
             }
          }
       }
+
+      Stats::endStage(perThread_numCells[threadID], instructionList->size());
    }
 
    std::cout << "COMPLETE" << std::endl;
@@ -1233,6 +1159,329 @@ void Skin::privatizeMemory(std::deque < Instruction * > *instructionList, UINT_3
 //END privatizeMemory
 
 
+/**
+ * @ingroup Skin
+ * @brief   Turns a share of the ALU operations into multiplies and divides
+ *
+ * Each share is accumulated over the cell's operations of its class and an operation is converted
+ * whenever a whole one is owed, so the long-latency operations are spread evenly through the loop
+ * body and the remainder instead of clustering, and a loop body repeats the ratio it was given.
+ *
+ * @param instructionList 
+ * @param intMultShare Share of integer ALU operations that multiply
+ * @param intDivShare Share of integer ALU operations that divide
+ * @param fpMultShare Share of floating-point operations that multiply
+ * @param fpDivShare Share of floating-point operations that divide
+ */
+void Skin::lengthenOperations(std::deque < Instruction * > *instructionList, float intMultShare, float intDivShare, float fpMultShare, float fpDivShare)
+{
+   /* Variables */
+   float owed[4] = { 0.0, 0.0, 0.0, 0.0 };                         //int mult, int div, fp mult, fp div
+   const float WHOLE = 0.9999;                                     //absorbs rounding in the running sums
+
+   /* Processes */
+   for(std::deque < Instruction * >::iterator instructionList_it = instructionList->begin(); instructionList_it != instructionList->end(); instructionList_it++)
+   {
+      if((*instructionList_it)->get_opCode() == iALU)
+      {
+         owed[0] = owed[0] + intMultShare;
+         owed[1] = owed[1] + intDivShare;
+
+         if(owed[0] >= WHOLE)
+         {
+            owed[0] = owed[0] - 1.0;
+            (*instructionList_it)->set_opCode(iMult);
+         }
+         else if(owed[1] >= WHOLE)
+         {
+            owed[1] = owed[1] - 1.0;
+            (*instructionList_it)->set_opCode(iDiv);
+         }
+      }
+      else if((*instructionList_it)->get_opCode() == fpALU)
+      {
+         owed[2] = owed[2] + fpMultShare;
+         owed[3] = owed[3] + fpDivShare;
+
+         if(owed[2] >= WHOLE)
+         {
+            owed[2] = owed[2] - 1.0;
+            (*instructionList_it)->set_opCode(fpMult);
+         }
+         else if(owed[3] >= WHOLE)
+         {
+            owed[3] = owed[3] - 1.0;
+            (*instructionList_it)->set_opCode(fpDiv);
+         }
+      }
+   }
+}
+//END lengthenOperations
+
+
+/**
+ * @ingroup Skin
+ * @brief   Turns a share of the integer ALU operations into conditional branches
+ *
+ * The branches are spread like lengthenOperations spreads multiplies and divides. Body decides
+ * each branch from the thread's outcome table, so the taken rate and predictability are set at
+ * write time and the stream only marks where the branches go.
+ *
+ * @param instructionList 
+ * @param share Share of integer ALU operations that branch
+ */
+void Skin::conditionBranches(std::deque < Instruction * > *instructionList, float share)
+{
+   /* Variables */
+   float owed = 0.0;
+   const float WHOLE = 0.9999;                                     //absorbs rounding in the running sum
+
+   /* Processes */
+   for(std::deque < Instruction * >::iterator instructionList_it = instructionList->begin(); instructionList_it != instructionList->end(); instructionList_it++)
+   {
+      if((*instructionList_it)->get_opCode() == iALU)
+      {
+         owed = owed + share;
+
+         if(owed >= WHOLE)
+         {
+            owed = owed - 1.0;
+            (*instructionList_it)->set_opCode(iBJ);
+            (*instructionList_it)->set_subCode(BJCond);
+         }
+      }
+   }
+}
+//END conditionBranches
+
+
+/**
+ * @ingroup Skin
+ * @brief   Turns private loads into pointer-chasing loads
+ *
+ * Reused private loads are taken before unique ones so the cell keeps the unique offsets it asked
+ * for; shared and matched loads are never taken. The chosen loads are dealt to the chains in stream
+ * order, so the misses of different chains overlap while each chain's loads stay serialized. A cell
+ * with too few private loads gets shorter chains.
+ *
+ * @param instructionList 
+ * @param chains Number of chains, at most MAX_CHASE_CHAINS
+ * @param length Dependent loads per chain
+ */
+void Skin::chaseMemory(std::deque < Instruction * > *instructionList, UINT_32 chains, UINT_32 length)
+{
+   /* Variables */
+   UINT_32 needed = chains * length;
+   UINT_32 chain = 0;
+   std::vector< BOOL > chosen(instructionList->size(), 0);
+
+   /* Processes */
+   for(UINT_32 unique = 0; unique < 2 && needed > 0; unique++)
+   {
+      for(UINT_32 index = 0; index < instructionList->size() && needed > 0; index++)
+      {
+         Instruction *instruction = instructionList->at(index);
+
+         if(instruction->get_opCode() == iLoad && instruction->get_isShared() == 0 && instruction->get_isUnique() == unique && instruction->get_matchedInstruction() == -1 && chosen[index] == 0)
+         {
+            chosen[index] = 1;
+            needed = needed - 1;
+         }
+      }
+   }
+
+   for(UINT_32 index = 0; index < instructionList->size(); index++)
+   {
+      if(chosen[index] == 1)
+      {
+         instructionList->at(index)->set_subCode(MemChase);
+         instructionList->at(index)->set_immediate(chain);
+         chain = (chain + 1) % chains;
+      }
+   }
+}
+//END chaseMemory
+
+
+/**
+ * @ingroup Skin
+ * @brief   Chooses registers so values are used a fixed number of producers after they are made
+ *
+ * ALU operations are dealt round robin to chains, each of which owns one register: every operation
+ * reads and writes its chain's register, so with d chains a value is used d operations after it is
+ * made and d operations can issue together. Loads all write one more register, which is the second
+ * source of every integer ALU operation, so each operation also waits for the latest load without
+ * loads breaking a chain. Stores write the value of the latest ALU operation. Floating-point
+ * operations form chains of their own with a second source nothing in the cell writes.
+ *
+ * A critical-path target is turned into the number of chains that spreads the cell's ALU operations
+ * over that many levels. Either way the chain count is capped by the registers available: 7
+ * integer and 5 floating point.
+ *
+ * @param instructionList 
+ * @param distance Producers between a value and its first use, 0 to use criticalPath
+ * @param criticalPath Longest dependence chain wanted per class of operation
+ */
+void Skin::assignRegisters(std::deque < Instruction * > *instructionList, UINT_32 distance, UINT_32 criticalPath)
+{
+   /* Variables */
+   static const RegType intChain[] = { T2, T3, T4, T5, S0, S1, S2 };
+   static const RegType fpChain[]  = { FP2, FP4, FP6, FP8, FP10 };
+   RegType const loadRegister = S3;                               //every load's destination
+   RegType const fpSource = FP12;                                 //never written by the cell
+
+   UINT_32 intProducers = 0;
+   UINT_32 fpProducers  = 0;
+   UINT_32 intChains;
+   UINT_32 fpChains;
+   UINT_32 lastChain = 0;
+
+   /* Processes */
+   for(std::deque < Instruction * >::iterator instructionList_it = instructionList->begin(); instructionList_it != instructionList->end(); instructionList_it++)
+   {
+      if((*instructionList_it)->is_intArithmetic())
+         intProducers = intProducers + 1;
+      else if((*instructionList_it)->is_fpArithmetic())
+         fpProducers = fpProducers + 1;
+   }
+
+   if(distance > 0)
+      intChains = fpChains = distance;
+   else
+   {
+      intChains = (intProducers + criticalPath - 1) / criticalPath;
+      fpChains  = (fpProducers + criticalPath - 1) / criticalPath;
+   }
+
+   intChains = std::max(UINT_32(1), std::min(intChains, UINT_32(sizeof(intChain) / sizeof(intChain[0]))));
+   fpChains  = std::max(UINT_32(1), std::min(fpChains, UINT_32(sizeof(fpChain) / sizeof(fpChain[0]))));
+
+   intProducers = fpProducers = 0;
+   for(std::deque < Instruction * >::iterator instructionList_it = instructionList->begin(); instructionList_it != instructionList->end(); instructionList_it++)
+   {
+      if((*instructionList_it)->is_intArithmetic())
+      {
+         lastChain = intProducers % intChains;
+         intProducers = intProducers + 1;
+
+         (*instructionList_it)->set_rs(intChain[lastChain]);
+         (*instructionList_it)->set_rt(loadRegister);
+         (*instructionList_it)->set_rd(intChain[lastChain]);
+      }
+      else if((*instructionList_it)->get_opCode() == iLoad && (*instructionList_it)->get_subCode() != MemChase)
+      {
+         (*instructionList_it)->set_rd(loadRegister);
+      }
+      else if((*instructionList_it)->get_opCode() == iStore)
+      {
+         (*instructionList_it)->set_rd(intChain[lastChain]);
+      }
+      else if((*instructionList_it)->is_fpArithmetic())
+      {
+         UINT_32 chain = fpProducers % fpChains;
+         fpProducers = fpProducers + 1;
+
+         (*instructionList_it)->set_rs(fpChain[chain]);
+         (*instructionList_it)->set_rt(fpSource);
+         (*instructionList_it)->set_rd(fpChain[chain]);
+      }
+   }
+}
+//END assignRegisters
+
+
+/**
+ * @ingroup Skin
+ * @brief   Prints the instruction-level parallelism the registers allow
+ *
+ * Each cell is walked once in stream order with unit latencies and only read-after-write
+ * dependences, in the three-operand form rd = rs op rt (the x86_64 backend also reads rd). A
+ * dependence through a register is one through the variable it is written to, so registers
+ * that share a variable depend on each other. A cell's ILP is its operations divided by its
+ * longest chain; dependences carried from one loop iteration to the next are not counted.
+ *
+ * @param threadID 
+ * @param instructionList 
+ */
+void Skin::reportILP(THREAD_ID threadID, std::deque < Instruction * > *instructionList)
+{
+   /* Variables */
+   std::map< std::string, UINT_32 > ready;                        //depth at which each variable's value is ready
+   UINT_32 cellOps = 0, cellPath = 0;
+   UINT_64 totalOps = 0, totalPath = 0;
+   UINT_32 cells = 0;
+   double minILP = 0.0, maxILP = 0.0;
+
+   /* Processes */
+   for(std::deque < Instruction * >::iterator instructionList_it = instructionList->begin(); instructionList_it != instructionList->end(); instructionList_it++)
+   {
+      Instruction *instruction = *instructionList_it;
+      UINT_32 depth = 0;
+
+      if(instruction->is_intArithmetic())
+      {
+         depth = 1 + std::max(ready[Instruction::getIntVariable(instruction->get_rs())], ready[Instruction::getIntVariable(instruction->get_rt())]);
+         ready[Instruction::getIntVariable(instruction->get_rd())] = depth;
+      }
+      else if(instruction->is_fpArithmetic())
+      {
+         depth = 1 + std::max(ready[Instruction::getFPVariable(instruction->get_rs())], ready[Instruction::getFPVariable(instruction->get_rt())]);
+         ready[Instruction::getFPVariable(instruction->get_rd())] = depth;
+      }
+      else if(instruction->get_opCode() == iLoad && instruction->get_subCode() == MemChase)
+      {
+         std::string chain = "chase_" + Instruction::IntToString(instruction->get_immediate());
+
+         depth = 1 + ready[chain];
+         ready[chain] = depth;
+      }
+      else if(instruction->get_opCode() == iLoad)
+      {
+         depth = 1;
+         ready[Instruction::getIntVariable(instruction->get_rd())] = depth;
+      }
+      else if(instruction->get_opCode() == iStore)
+         depth = 1 + ready[Instruction::getIntVariable(instruction->get_rd())];
+      else if(instruction->get_opCode() == iBJ && instruction->get_subCode() == BJCond)
+         depth = 1;
+      else if(instruction->get_opCode() == iBJ)
+      {
+         if(cellOps > 0)
+         {
+            double ilp = double(cellOps) / cellPath;
+
+            minILP = cells == 0 ? ilp : std::min(minILP, ilp);
+            maxILP = cells == 0 ? ilp : std::max(maxILP, ilp);
+            cells = cells + 1;
+
+            totalOps = totalOps + cellOps;
+            totalPath = totalPath + cellPath;
+
+            #if defined(VERBOSE)
+            std::cout << "   ILP (T" << threadID << " cell " << cells - 1 << "):  " << cellOps << " ops, path " << cellPath << ", " << ilp << "\n";
+            #endif
+         }
+
+         ready.clear();
+         cellOps = cellPath = 0;
+         continue;
+      }
+      else
+         continue;
+
+      cellOps = cellOps + 1;
+      cellPath = std::max(cellPath, depth);
+   }
+
+   std::ostringstream report;
+   report << std::fixed << std::setprecision(2) << (totalPath > 0 ? double(totalOps) / totalPath : 0.0);
+   report << " overall (" << minILP << " - " << maxILP << " per cell)";
+
+   std::cout << "Achieved ILP -- thread " << threadID << ":  " << cells << " cells, " << report.str() << "\n";
+}
+//END reportILP
+
+
 /**
  * @ingroup Skin
  *
@@ -1325,10 +1574,10 @@ void Skin::localizeMemory(std::deque < Instruction * > *instructionList, UINT_32
  * @ingroup Skin
  * 
  * @param instructionList 
- * @param readConflictList 
- * @param writeConflictList 
+ * @param readConflicts 
+ * @param writeConflicts 
  */
-void Skin::specifyMemory(std::deque < Instruction * > *instructionList, std::list< CONFLICT_PAIR >* readConflictList, std::list< CONFLICT_PAIR >* writeConflictList)
+void Skin::specifyMemory(std::deque < Instruction * > *instructionList, const ConflictRange &readConflicts, const ConflictRange &writeConflicts)
 {
    /* Variables */
    BOOL        isShared;
@@ -1337,12 +1586,12 @@ void Skin::specifyMemory(std::deque < Instruction * > *instructionList, std::lis
 
    Instruction *tempInstruction;
 
-   std::list< CONFLICT_PAIR >::const_iterator conflictList_it;
+   ConflictRange::const_iterator conflictList_it;
    std::deque< Instruction * >::iterator instructionList_it;
 
    /* Processes */
    //iterate through the list of conflicting LOADS and mark the instructions in the synthetic instruction list
-   for(conflictList_it = readConflictList->begin(); conflictList_it != readConflictList->end(); conflictList_it++)
+   for(conflictList_it = readConflicts.begin(); conflictList_it != readConflicts.end(); conflictList_it++)
    {
       address = conflictList_it->first;
       lineNumber = conflictList_it->second;
@@ -1384,7 +1633,7 @@ void Skin::specifyMemory(std::deque < Instruction * > *instructionList, std::lis
    }//--END LOADS
 
    //iterate through the list of conflicting STORES and mark the instructions in the synthetic instruction list
-   for(conflictList_it = writeConflictList->begin(); conflictList_it != writeConflictList->end(); conflictList_it++)
+   for(conflictList_it = writeConflicts.begin(); conflictList_it != writeConflicts.end(); conflictList_it++)
    {
       address = conflictList_it->first;
       lineNumber = conflictList_it->second;
@@ -1432,10 +1681,10 @@ void Skin::specifyMemory(std::deque < Instruction * > *instructionList, std::lis
  * @ingroup Skin
  * 
  * @param instructionList 
- * @param readConflictList 
- * @param writeConflictList 
+ * @param readConflicts 
+ * @param writeConflicts 
  */
-void Skin::prioritizeMemory(std::deque < Instruction * > *instructionList, std::list< CONFLICT_PAIR >* readConflictList, std::list< CONFLICT_PAIR >* writeConflictList)
+void Skin::prioritizeMemory(std::deque < Instruction * > *instructionList, const ConflictRange &readConflicts, const ConflictRange &writeConflicts)
 {
    /* Variables */
    UINT_32 lowest;
@@ -1449,18 +1698,18 @@ void Skin::prioritizeMemory(std::deque < Instruction * > *instructionList, std::
    std::deque< Instruction * >::iterator instructionListSearch_it;
 
    /* Processes */
-   firstAllowedRead  = readConflictList->front().second;
-   firstAllowedWrite = writeConflictList->front().second;
+   firstAllowedRead  = readConflicts.empty() ? 0 : readConflicts.front().second;
+   firstAllowedWrite = writeConflicts.empty() ? 0 : writeConflicts.front().second;
 
    //find first unique load
-   for(std::list< CONFLICT_PAIR >::const_iterator conflictList_it = readConflictList->begin(); conflictList_it != readConflictList->end(); conflictList_it++)
+   for(ConflictRange::const_iterator conflictList_it = readConflicts.begin(); conflictList_it != readConflicts.end(); conflictList_it++)
    {
       if(conflictList_it->second < firstAllowedRead)
          firstAllowedRead = conflictList_it->second;
    }
 
    //find first unique store
-   for(std::list< CONFLICT_PAIR >::const_iterator conflictList_it = writeConflictList->begin(); conflictList_it != writeConflictList->end(); conflictList_it++)
+   for(ConflictRange::const_iterator conflictList_it = writeConflicts.begin(); conflictList_it != writeConflicts.end(); conflictList_it++)
    {
       if(conflictList_it->second < firstAllowedWrite)
          firstAllowedWrite = conflictList_it->second;
@@ -1791,7 +2040,9 @@ void Skin::randomizeInstructionStream(std::deque < Instruction * > *instructionL
       ++instructionList_it_loop_begin;
       --instructionList_it_loop_end;
 
+      //a tight code budget can leave almost nothing in the body, and then there is nothing to shuffle
 //       for(UINT_32 brokenMixer = 0; brokenMixer < 5; brokenMixer++)
+      if(instructionList_it_loop_begin < instructionList_it_loop_end)
          std::random_shuffle(instructionList_it_loop_begin, instructionList_it_loop_end);
    }
 
@@ -29,9 +29,10 @@
 #include "Config.h"
 #include "Skeleton.h"
 #include "Instruction.h"
+#include "LoopSolver.h"
 
-///NOTE Internal loops require 3 integer ALU ops and 1 branch per cell
-#define EXTRA_LOOP_OPS 4
+///NOTE Largest trip count a single cell loop can compare against (slti immediate is signed)
+#define MAX_LOOP_ITERATIONS _15_BIT_RANGE
 
 /**
  * @ingroup Skin
@@ -46,6 +47,8 @@ class Skin : public Skeleton
       Skin(Skeleton &skeletonIn);
       ~Skin();
 
+      void swap(Skin &skinIn);
+
       /* Variables */
 
       /* Functions */
@@ -55,22 +58,36 @@ class Skin : public Skeleton
       void insertVertebrae(void);
       void synchronize(void);
 
+      const std::deque< Instruction * > *getInstructionList(THREAD_ID threadID) const;
+
    protected:
       Config *config;
       std::vector< std::deque< Instruction * > * > perThread_instructionList;
+      std::vector< UINT_64 > perThread_numCells;                     //cells each stream was built from; kept after releaseCells
+
+      void releaseInstructions(THREAD_ID threadID);
 
    private:
+      //not copyable -- the destructor frees the streams, so they are only handed over by swap
+      Skin(const Skin &skinIn);
+      Skin &operator=(const Skin &skinIn);
+
       UINT_32 matchID;
 
       void makeStrideLoops(std::deque < Instruction * > *instructionList, std::deque< UINT_32 > *conflictDistances);
-      void getDistanceList(std::deque < Instruction * > *instructionList, std::list< CONFLICT_PAIR >* readConflictList, std::list< CONFLICT_PAIR >* writeConflictList, std::deque<UINT_32> *conflictDistances);
+      void getDistanceList(std::deque < Instruction * > *instructionList, const ConflictRange &readConflicts, const ConflictRange &writeConflicts, std::deque<UINT_32> *conflictDistances);
 
       void localizeMemory(std::deque < Instruction * > *instructionList, UINT_32 sharedReads, UINT_32 sharedWrites);
       void privatizeMemory(std::deque < Instruction * > *instructionList, UINT_32 sharedReads, UINT_32 sharedWrites);
-      void specifyMemory(std::deque < Instruction * > *instructionList, std::list< CONFLICT_PAIR >* readConflictList, std::list< CONFLICT_PAIR >* writeConflictList);
-      void prioritizeMemory(std::deque < Instruction * > *instructionList, std::list< CONFLICT_PAIR >* readConflictList, std::list< CONFLICT_PAIR >* writeConflictList);
+      void specifyMemory(std::deque < Instruction * > *instructionList, const ConflictRange &readConflicts, const ConflictRange &writeConflicts);
+      void prioritizeMemory(std::deque < Instruction * > *instructionList, const ConflictRange &readConflicts, const ConflictRange &writeConflicts);
       void conflictizeMemory(std::deque < Instruction * > *instructionList, UINT_32 uniqueLoads, UINT_32 uniqueStores, BOOL useLoops, UINT_32 iterations, UINT_32 remainder, UINT_32 loopSize);
       void randomizeInstructionStream(std::deque < Instruction * > *instructionList, ConflictType conflictType, CellType cellType, UINT_32 sharedReads, UINT_32 sharedWrites, BOOL useLoops);
+      void lengthenOperations(std::deque < Instruction * > *instructionList, float intMultShare, float intDivShare, float fpMultShare, float fpDivShare);
+      void conditionBranches(std::deque < Instruction * > *instructionList, float share);
+      void chaseMemory(std::deque < Instruction * > *instructionList, UINT_32 chains, UINT_32 length);
+      void assignRegisters(std::deque < Instruction * > *instructionList, UINT_32 distance, UINT_32 criticalPath);
+      void reportILP(THREAD_ID threadID, std::deque < Instruction * > *instructionList);
 
 };
 
@@ -0,0 +1,245 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the implementation for the Stats collector.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Implementation: Stats
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <new>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <sys/time.h>
+#include <sys/resource.h>
+
+#include "Stats.h"
+
+BOOL                       Stats::enabled = 0;
+std::string                Stats::reportName;
+std::vector< StatRecord >  Stats::records;
+std::vector< UINT_32 >     Stats::openRecords;
+
+//heap allocations go through here so the stages can be charged for them; only counted with --stats
+static UINT_64 allocationCount = 0;
+
+void* operator new(std::size_t size)
+{
+   if(Stats::isEnabled())
+      allocationCount = allocationCount + 1;
+
+   void *memory = malloc(size > 0 ? size : 1);
+   if(memory == 0)
+      throw std::bad_alloc();
+
+   return memory;
+}
+
+void operator delete(void *memory) throw()
+{
+   free(memory);
+}
+
+void operator delete(void *memory, std::size_t) throw()
+{
+   free(memory);
+}
+
+/**
+ * @ingroup Stats
+ *
+ * @param fileName Report name -- a '.json' suffix selects JSON, anything else is CSV
+ */
+void Stats::enable(const std::string &fileName)
+{
+   enabled = 1;
+   reportName = fileName;
+}
+
+BOOL Stats::isEnabled(void)
+{
+   return enabled;
+}
+
+UINT_64 Stats::get_allocationCount(void)
+{
+   return allocationCount;
+}
+
+double Stats::get_wallClock(void)
+{
+   struct timeval now;
+   gettimeofday(&now, 0);
+
+   return now.tv_sec + now.tv_usec / 1000000.0;
+}
+
+double Stats::get_cpuClock(void)
+{
+   struct rusage usage;
+   getrusage(RUSAGE_SELF, &usage);
+
+   return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1000000.0 +
+          usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1000000.0;
+}
+
+UINT_64 Stats::get_peakRSS(void)
+{
+   struct rusage usage;
+   getrusage(RUSAGE_SELF, &usage);
+
+   return usage.ru_maxrss;
+}
+
+const std::vector< StatRecord > &Stats::get_records(void)
+{
+   return records;
+}
+
+/**
+ * @ingroup Stats
+ * @brief   Drops all records (open and closed) so a new run can be measured
+ */
+void Stats::reset(void)
+{
+   records.clear();
+   openRecords.clear();
+}
+
+/**
+ * @ingroup Stats
+ * @brief   Opens a new measured interval
+ *
+ * @param stage
+ * @param threadID STATS_ALL_THREADS if the stage is not specific to one thread
+ */
+void Stats::beginStage(const std::string &stage, THREAD_ID threadID)
+{
+   if(enabled == 0)
+      return;
+
+   StatRecord record;
+
+   record.stage = stage;
+   record.threadID = threadID;
+   record.depth = openRecords.size();
+   record.cells = record.instructions = record.bytesWritten = 0;
+
+   //start values are held in the record until the stage ends
+   record.wallTime = get_wallClock();
+   record.cpuTime = get_cpuClock();
+   record.allocations = allocationCount;
+   record.rssGrowth = get_peakRSS();
+
+   openRecords.push_back(records.size());
+   records.push_back(record);
+}
+
+/**
+ * @ingroup Stats
+ * @brief   Closes the most recently opened interval
+ *
+ * @param cells
+ * @param instructions
+ * @param bytesWritten
+ */
+void Stats::endStage(UINT_64 cells, UINT_64 instructions, UINT_64 bytesWritten)
+{
+   if(enabled == 0 || openRecords.empty())
+      return;
+
+   StatRecord &record = records[openRecords.back()];
+   openRecords.pop_back();
+
+   record.wallTime = get_wallClock() - record.wallTime;
+   record.cpuTime = get_cpuClock() - record.cpuTime;
+   record.allocations = allocationCount - record.allocations;
+   record.rssGrowth = get_peakRSS() - record.rssGrowth;
+
+   record.cells = cells;
+   record.instructions = instructions;
+   record.bytesWritten = bytesWritten;
+}
+
+/**
+ * @ingroup Stats
+ * @brief   Writes every closed record to the report file
+ *
+ * @return 0 if the report could not be written
+ */
+BOOL Stats::writeReport(void)
+{
+   if(enabled == 0)
+      return 1;
+
+   std::ofstream outputFile(reportName.c_str(), std::ios::trunc);
+   if(!outputFile)
+   {
+      std::cerr << "Error opening stats file " << reportName << ".\n";
+      return 0;
+   }
+
+   if(reportName.size() > 5 && reportName.compare(reportName.size() - 5, 5, ".json") == 0)
+      writeJSON(outputFile);
+   else
+      writeCSV(outputFile);
+
+   outputFile.close();
+   std::cout << "Stats written to " << reportName << std::endl;
+
+   return 1;
+}
+
+void Stats::writeCSV(std::ofstream &outputFile)
+{
+   outputFile << "stage,thread,depth,wall_s,cpu_s,rss_growth_kb,allocations,cells,instructions,bytes_written\n";
+   outputFile << std::fixed << std::setprecision(6);
+
+   for(std::vector< StatRecord >::const_iterator record_it = records.begin(); record_it != records.end(); record_it++)
+   {
+      outputFile << record_it->stage << ",";
+      if(record_it->threadID == STATS_ALL_THREADS)
+         outputFile << "all,";
+      else
+         outputFile << record_it->threadID << ",";
+
+      outputFile << record_it->depth << ",";
+      outputFile << record_it->wallTime << "," << record_it->cpuTime << ",";
+      outputFile << record_it->rssGrowth << "," << record_it->allocations << ",";
+      outputFile << record_it->cells << "," << record_it->instructions << "," << record_it->bytesWritten << "\n";
+   }
+}
+
+void Stats::writeJSON(std::ofstream &outputFile)
+{
+   outputFile << "{\n  \"stages\": [\n";
+   outputFile << std::fixed << std::setprecision(6);
+
+   for(std::vector< StatRecord >::const_iterator record_it = records.begin(); record_it != records.end(); record_it++)
+   {
+      outputFile << "    { \"stage\": \"" << record_it->stage << "\", \"thread\": ";
+      if(record_it->threadID == STATS_ALL_THREADS)
+         outputFile << "null";
+      else
+         outputFile << record_it->threadID;
+
+      outputFile << ", \"depth\": " << record_it->depth;
+      outputFile << ", \"wall_s\": " << record_it->wallTime << ", \"cpu_s\": " << record_it->cpuTime;
+      outputFile << ", \"rss_growth_kb\": " << record_it->rssGrowth << ", \"allocations\": " << record_it->allocations;
+      outputFile << ", \"cells\": " << record_it->cells << ", \"instructions\": " << record_it->instructions;
+      outputFile << ", \"bytes_written\": " << record_it->bytesWritten << " }";
+
+      if(record_it + 1 != records.end())
+         outputFile << ",";
+      outputFile << "\n";
+   }
+
+   outputFile << "  ]\n}\n";
+}
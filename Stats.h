@@ -0,0 +1,87 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the interface for the Stats collector.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Interface: Stats
+ * Records wall time, CPU time, growth of the peak RSS, heap allocations and item counts for each
+ * generator stage (and each thread within a stage) and writes a machine-readable
+ * report. Stages may be nested; the outer record includes the cost of the inner ones.
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef STATS_H
+#define STATS_H
+
+#include <string>
+#include <vector>
+#include <fstream>
+
+#include "param_types.h"
+
+///NOTE Thread ID used for records that cover every thread
+#define STATS_ALL_THREADS 0xFFFFFFFF
+
+/**
+ * @ingroup Stats
+ * @brief   One measured interval
+ */
+struct StatRecord
+{
+   std::string    stage;
+   THREAD_ID      threadID;
+   UINT_32        depth;                  //nesting level of the stage
+
+   double         wallTime;               //seconds
+   double         cpuTime;                //seconds (user + system)
+   UINT_64        rssGrowth;              //kilobytes the process high-water mark rose during the stage
+   UINT_64        allocations;            //heap allocations made during the stage
+
+   UINT_64        cells;
+   UINT_64        instructions;
+   UINT_64        bytesWritten;
+};
+
+/**
+ * @ingroup Stats
+ * @brief   Per-stage instrumentation for the generator
+ *
+ * This class is used statically so every stage can record itself without having
+ * the collector threaded through the pipeline. When it is not enabled all calls
+ * return immediately.
+ */
+class Stats
+{
+   public:
+      static void          enable(const std::string &fileName);
+      static BOOL          isEnabled(void);
+
+      static void          beginStage(const std::string &stage, THREAD_ID threadID = STATS_ALL_THREADS);
+      static void          endStage(UINT_64 cells = 0, UINT_64 instructions = 0, UINT_64 bytesWritten = 0);
+
+      static const std::vector< StatRecord > &get_records(void);
+      static void          reset(void);
+      static BOOL          writeReport(void);
+
+      static UINT_64       get_allocationCount(void);
+      static double        get_wallClock(void);
+      static double        get_cpuClock(void);
+      static UINT_64       get_peakRSS(void);
+
+   private:
+      static BOOL                         enabled;
+      static std::string                  reportName;
+      static std::vector< StatRecord >    records;
+      static std::vector< UINT_32 >       openRecords;                   //indices of stages that have not ended
+
+      static void          writeCSV(std::ofstream &outputFile);
+      static void          writeJSON(std::ofstream &outputFile);
+};
+
+#endif
@@ -0,0 +1,190 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the implementation for the x86-64 backend.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Implementation: X86Backend
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "X86Backend.h"
+
+std::string X86Backend::intVariable(RegType registerIn) const
+{
+   return Instruction::getIntVariable(registerIn);
+}
+
+/**
+ * @ingroup Backend
+ * @brief   Same variables as MIPS, but held in SSE registers
+ */
+std::string X86Backend::fpVariable(RegType registerIn) const
+{
+   std::string variable = Instruction::getFPVariable(registerIn);
+
+   if(variable.size() > 0)
+      variable[0] = 'x';
+
+   return variable;
+}
+
+/**
+ * @ingroup Backend
+ * @brief   Compiler barriers by default; define the macros before compiling to plug in a TM
+ *
+ * @param outputFile
+ */
+void X86Backend::writeTransactionMacros(std::ostream &outputFile)
+{
+   outputFile << "#ifndef BEGIN_TRANSACTION\n";
+   outputFile << "#define BEGIN_TRANSACTION(n) __asm__ __volatile__ (\"\" : : : \"memory\")\n";
+   outputFile << "#endif\n\n";
+
+   outputFile << "#ifndef COMMIT_TRANSACTION\n";
+   outputFile << "#define COMMIT_TRANSACTION(n) __asm__ __volatile__ (\"\" : : : \"memory\")\n";
+   outputFile << "#endif\n";
+}
+
+void X86Backend::writeSharedBase(std::ostream &outputFile)
+{
+   outputFile << "intptr_t s_data_out_int;\n";
+}
+
+/**
+ * @ingroup Backend
+ * @brief   The working values are plain locals; the register allocator places them
+ *
+ * @param outputFile
+ */
+void X86Backend::writeRegisters(std::ostream &outputFile)
+{
+   outputFile << "   int r_out_t0 = 0, r_out_t1 = 0, r_out_t2 = 0, r_out_t3 = 0, r_out_t4 = 0, r_out_t5 = 0;\n";
+   outputFile << "   int r_out_s0 = 0, r_out_s1 = 0, r_out_s2 = 0, r_out_s3 = 0, r_out_s4 = 0, r_out_s5 = 0;\n";
+   outputFile << "   double r_out_f2 = 0.0, r_out_f4 = 0.0, r_out_f6 = 0.0, r_out_f8 = 0.0, r_out_f10 = 0.0, r_out_f12 = 0.0;\n";
+
+   outputFile << "\n   intptr_t data_out_int;\n";
+   outputFile << "   intptr_t data_out_float;\n";
+
+   //loop counters
+   outputFile << "   int cell_counter = 0;\t\t//inner loop counter\n";
+   outputFile << "   int block_counter = 0;\t\t//outer loop counter\n";
+   outputFile << "   int nest_counter = 0;\t\t//nested cell loop counter\n";
+}
+
+/**
+ * @ingroup Backend
+ * @brief   Instructions are written individually
+ *
+ * x86 is two-operand, so ALU operations read and write rd and take rs as the source;
+ * rt is dropped. Body builds the operands in MIPS order, so source and destination swap here.
+ *
+ * @param outputFile
+ * @param instructionIn
+ * @param operandList
+ */
+void X86Backend::writeInstruction(std::ostream &outputFile, Instruction *instructionIn, OperandList &operandList)
+{
+   /* Variables */
+
+   /* Processes */
+   if(instructionIn->get_opCode() == iBJ && instructionIn->get_subCode() == BJCond)
+   {
+      //taken skips the nop, so either outcome can be mispredicted
+      outputFile << "   __asm__ __volatile__ ( \"testl %0, %0\\n\\tjnz 1f\\n\\tnop\\n1:\"\t : : \"" << operandList.rs_variable << " : \"cc\" );" << std::endl;
+      return;
+   }
+   else if(instructionIn->get_opCode() == iBJ)
+   {
+      outputFile << "   goto " << operandList.rd << ";" << std::endl;
+      return;
+   }
+
+   outputFile << "   __asm__ __volatile__ ( \"";
+
+   if(instructionIn->get_opCode() == iALU)
+   {
+      outputFile << "xorl " << operandList.rs << ", " << operandList.rd << "\"\t :";
+      outputFile << " \"+" << operandList.rd_variable << " : \"" << operandList.rs_variable;
+   }
+   else if(instructionIn->get_opCode() == iMult)
+   {
+      outputFile << "imull " << operandList.rs << ", " << operandList.rd << "\"\t :";
+      outputFile << " \"+" << operandList.rd_variable << " : \"" << operandList.rs_variable;
+   }
+   else if(instructionIn->get_opCode() == iDiv)
+   {
+      //unsigned, and the divisor made odd, so it can neither trap nor overflow
+      outputFile << "xorl %%edx, %%edx\\n\\tdivl " << operandList.rs << "\"\t :";
+      outputFile << " \"+a\"(" << variableName(operandList.rd_variable) << ") : \"r\"((unsigned) " << variableName(operandList.rs_variable) << " | 1)";
+      outputFile << " : \"edx\", \"cc\"";
+   }
+   else if(instructionIn->get_opCode() == fpALU)
+   {
+      outputFile << "addsd " << operandList.rs << ", " << operandList.rd << "\"\t :";
+      outputFile << " \"+" << operandList.rd_variable << " : \"" << operandList.rs_variable;
+   }
+   else if(instructionIn->get_opCode() == fpMult)
+   {
+      outputFile << "mulsd " << operandList.rs << ", " << operandList.rd << "\"\t :";
+      outputFile << " \"+" << operandList.rd_variable << " : \"" << operandList.rs_variable;
+   }
+   else if(instructionIn->get_opCode() == fpDiv)
+   {
+      outputFile << "divsd " << operandList.rs << ", " << operandList.rd << "\"\t :";
+      outputFile << " \"+" << operandList.rd_variable << " : \"" << operandList.rs_variable;
+   }
+   else if(instructionIn->get_opCode() == iLoad && instructionIn->get_subCode() == MemChase)
+   {
+      //the node holds a full pointer
+      outputFile << "movq " << operandList.rs << ", " << operandList.rd << "\"\t :";
+      outputFile << " \"=" << operandList.rd_variable << " : \"" << operandList.rs_variable;
+   }
+   else if(instructionIn->get_opCode() == iLoad)
+   {
+      outputFile << "movl " << operandList.rs << ", " << operandList.rd << "\"\t :";
+      outputFile << " \"=" << operandList.rd_variable << " : \"" << operandList.rs_variable;
+   }
+   else if(instructionIn->get_opCode() == iStore)
+   {
+      outputFile << "movl " << operandList.rd << ", " << operandList.rt << "\"\t :";
+      outputFile << " : \"" << operandList.rt_variable << ", \"" << operandList.rd_variable;
+   }
+
+   if(operandList.clobberList.size() > 0)
+      outputFile << " : " << operandList.clobberList;
+
+   outputFile << " );";
+
+   outputFile << std::endl;
+}
+
+void X86Backend::writeLabel(std::ostream &outputFile, const std::string &label)
+{
+   outputFile << "   " << label << ": ;";
+   outputFile << "\n";
+}
+
+void X86Backend::writeCounterReset(std::ostream &outputFile, const std::string &counter, INT_32 value)
+{
+   outputFile << "   " << counter << " = " << value << ";\n";
+}
+
+/**
+ * @ingroup Backend
+ * @brief   Increments counter and branches back to label while it is below iterations
+ *
+ * @param outputFile
+ * @param counter
+ * @param iterations
+ * @param label
+ */
+void X86Backend::writeLoopBranch(std::ostream &outputFile, const std::string &counter, UINT_32 iterations, const std::string &label)
+{
+   outputFile << "   if(++" << counter << " < " << iterations << ") goto " << label << ";\n";
+}
@@ -0,0 +1,51 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   This is the interface for the x86-64 backend.
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * C++ Interface: X86Backend
+ * GCC inline assembly for x86-64 hosts. Loads, stores and ALU operations are still one
+ * asm statement each, so the mix and offsets match the MIPS output, but the working
+ * values are ordinary locals and the loops and branches are C gotos. The compiler
+ * therefore sees all of the control flow and the result is safe at any optimization level.
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef X86_BACKEND_H
+#define X86_BACKEND_H
+
+#include "Backend.h"
+
+/**
+ * @ingroup Backend
+ * @brief   x86-64 writer
+ *
+ */
+class X86Backend : public Backend
+{
+   public:
+      /* Functions */
+      std::string          get_name(void) const { return "x86_64"; }
+      std::string          get_addressType(void) const { return "intptr_t"; }
+
+      std::string          intVariable(RegType registerIn) const;
+      std::string          fpVariable(RegType registerIn) const;
+
+      void                 writeTransactionMacros(std::ostream &outputFile);
+      void                 writeSharedBase(std::ostream &outputFile);
+      void                 writeRegisters(std::ostream &outputFile);
+
+      void                 writeInstruction(std::ostream &outputFile, Instruction *instructionIn, OperandList &operandList);
+      void                 writeLabel(std::ostream &outputFile, const std::string &label);
+
+      void                 writeCounterReset(std::ostream &outputFile, const std::string &counter, INT_32 value);
+      void                 writeLoopBranch(std::ostream &outputFile, const std::string &counter, UINT_32 iterations, const std::string &label);
+};
+
+#endif
@@ -0,0 +1,316 @@
+/**
+ * @file
+ * @author  Clay Hughes   <>, (C) 2010
+ * @date    10/19/10
+ * @brief   Scaling benchmark for the generator itself
+ *
+ * @section LICENSE
+ * Copyright: See COPYING file that comes with this distribution
+ *
+ * @section DESCRIPTION
+ * Synthesizes descriptors in-process for a sweep of thread counts and runs the
+ * complete pipeline (validate, construct, skin, write) on each one. Every stage is
+ * measured with Stats and the throughput, in generated instructions per second, is
+ * reported per stage and per thread count.
+ */
+/////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdlib>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "Config.h"
+#include "ConfigValidator.h"
+#include "Skeleton.h"
+#include "ConstructSkeleton.h"
+#include "Skin.h"
+#include "Body.h"
+#include "Stats.h"
+
+/**
+ * @ingroup Bench
+ * @brief   Totals for one stage of one run
+ */
+struct BenchResult
+{
+   UINT_32        numThreads;
+   std::string    stage;
+   double         wallTime;
+   UINT_64        allocations;
+   UINT_64        rssGrowth;
+};
+
+/**
+ * @ingroup Bench
+ * @brief   Builds a heterogeneous descriptor with cellsPerThread transactions per thread
+ *
+ * @param numThreads
+ * @param cellsPerThread
+ * @param txSize Instructions in the smallest transaction; sizes cycle up to 1.75x this value
+ * @param conflictModel random, high, zipf or mixed (alternates high and random per transaction)
+ * @return New configuration; caller owns it
+ */
+static Config *synthesizeDescriptor(UINT_32 numThreads, UINT_32 cellsPerThread, UINT_32 txSize, const std::string &conflictModel)
+{
+   /* Variables */
+   Config *config = new Config();
+   const char *sharedFrequency[] = {"high", "low", "minimal"};
+
+   /* Processes */
+   config->add<unsigned int>("Global", "numThreads", numThreads);
+   config->add<string>("Global", "homogeneous", "false");
+   config->add<int>("Global", "numBarriers", 0);
+   config->add<int>("Global", "resetPerCell", 0);
+
+   for(UINT_32 threadID = 0; threadID < numThreads; threadID++)
+   {
+      std::ostringstream region;
+      std::ostringstream granularity, stride, readSet, writeSet, frequency, model;
+
+      region << "Thread" << threadID;
+
+      for(UINT_32 cell = 0; cell < cellsPerThread; cell++)
+      {
+         UINT_32 size = txSize + ((cell + threadID) % 4) * (txSize / 4);
+         std::string separator = (cell + 1 < cellsPerThread) ? " " : "";
+
+         granularity << size << separator;
+         stride << txSize << separator;
+         readSet << (size / 10 + 1) << separator;
+         writeSet << (size / 20 + 1) << separator;
+         frequency << sharedFrequency[cell % 3] << separator;
+
+         if(conflictModel == "mixed")
+            model << ((cell % 2) ? "high" : "random") << separator;
+         else
+            model << conflictModel << separator;
+      }
+
+      config->add<string>(region.str(), "transGranularity", granularity.str());
+      config->add<string>(region.str(), "transStride", stride.str());
+      config->add<string>(region.str(), "transReadSetSize", readSet.str());
+      config->add<string>(region.str(), "transWriteSetSize", writeSet.str());
+      config->add<string>(region.str(), "transSharedMemoryFrequency", frequency.str());
+      config->add<string>(region.str(), "transConflictDistributionModel", model.str());
+      config->add<string>(region.str(), "transInstructionMix", "0.4 0.4 0.2");
+      config->add<string>(region.str(), "sequentialInstructionMix", "0.3 0.5 0.2");
+   }
+
+   return config;
+}
+
+/**
+ * @ingroup Bench
+ * @brief   Splits a comma seperated list of thread counts
+ */
+static std::vector< UINT_32 > parseThreadList(const std::string &list)
+{
+   std::vector< UINT_32 > threadCounts;
+   std::istringstream input(list);
+   std::string token;
+
+   while(std::getline(input, token, ','))
+   {
+      UINT_32 numThreads = atoi(token.c_str());
+      if(numThreads < 1 || numThreads > 1024)
+      {
+         std::cerr << "Thread counts must be between 1 and 1024 (" << token << ")\n";
+         exit(1);
+      }
+      threadCounts.push_back(numThreads);
+   }
+
+   return threadCounts;
+}
+
+int main(int argc, char *argv[])
+{
+   /* Variables */
+   std::string threadList = "1,2,4,8,16,32,64,128,256,512,1024";
+   std::string conflictModel = "mixed";
+   std::string outputDir = "output/bench";
+   std::string descriptorDir;
+   std::string reportName;
+
+   UINT_32 cellsPerThread = 8;
+   UINT_32 txSize = 200;
+
+   std::vector< BenchResult > results;
+   std::map< UINT_32, UINT_64 > instructionsPerRun;
+
+   /* Processes */
+   int c;
+   opterr = 0;
+   while (( c = getopt( argc, argv, "t:c:s:m:o:d:r:h" ) ) != -1 )
+   {
+      switch ( c )
+      {
+         case 't':
+            threadList = optarg;
+            break;
+         case 'c':
+            cellsPerThread = atoi(optarg);
+            break;
+         case 's':
+            txSize = atoi(optarg);
+            break;
+         case 'm':
+            conflictModel = optarg;
+            break;
+         case 'o':
+            outputDir = optarg;
+            break;
+         case 'd':
+            descriptorDir = optarg;
+            break;
+         case 'r':
+            reportName = optarg;
+            break;
+         default:
+            std::cerr << "Usage: ./param_bench [options]\n";
+            std::cerr << "Options:\n";
+            std::cerr << "\t[-t n,n,...]\t\t Thread counts to sweep (1..1024)\n";
+            std::cerr << "\t[-c cells]\t\t Transactions per thread\n";
+            std::cerr << "\t[-s size]\t\t Base transaction size in instructions\n";
+            std::cerr << "\t[-m model]\t\t Conflict model: random, high, zipf or mixed\n";
+            std::cerr << "\t[-o dir]\t\t Directory for the generated programs\n";
+            std::cerr << "\t[-d dir]\t\t Also write the synthesized descriptors here\n";
+            std::cerr << "\t[-r file]\t\t Write the results as CSV\n";
+            std::cerr << std::endl;
+            return 1;
+      }
+   }
+
+   if(cellsPerThread < 1 || txSize < 40)
+   {
+      std::cerr << "Need at least one cell per thread and a transaction size of 40 or more\n";
+      return 1;
+   }
+
+   if(conflictModel != "random" && conflictModel != "high" && conflictModel != "zipf" && conflictModel != "mixed")
+   {
+      std::cerr << "Unknown conflict model " << conflictModel << "\n";
+      return 1;
+   }
+
+   mkdir(outputDir.c_str(), 0755);
+
+   std::vector< UINT_32 > threadCounts = parseThreadList(threadList);
+   Stats::enable(reportName);
+
+   for(std::vector< UINT_32 >::iterator thread_it = threadCounts.begin(); thread_it != threadCounts.end(); thread_it++)
+   {
+      UINT_32 numThreads = *thread_it;
+      std::string fileName = "bench_T" + Instruction::IntToString(numThreads) + ".in";
+
+      Stats::reset();
+
+      Stats::beginStage("configSynthesize");
+      Config *config = synthesizeDescriptor(numThreads, cellsPerThread, txSize, conflictModel);
+      Stats::endStage();
+
+      if(!descriptorDir.empty())
+      {
+         mkdir(descriptorDir.c_str(), 0755);
+         std::ofstream descriptorFile((descriptorDir + "/" + fileName).c_str(), std::ios::trunc);
+         descriptorFile << *config;
+      }
+
+      Stats::beginStage("configValidator");
+      if(!ConfigValidator::validate(config))
+      {
+         std::cerr << "Synthesized descriptor failed validation (" << numThreads << " threads)\n";
+         return 1;
+      }
+      Stats::endStage();
+
+      ConstructSkeleton skelGenerator(config);
+      Skeleton skeleton;
+      skelGenerator.createSkeleton().swap(skeleton);
+
+      config->add<bool>("Global", "barrierPerThread", 0);
+      config->add<string>("Global", "fileName", fileName);
+      config->add<string>("Global", "outputDir", outputDir);
+
+      Skin skin(skeleton);
+      skin.updateConfig(config);
+      skin.spinalColumn();
+      skin.releaseCells();
+      skin.insertVertebrae();
+
+      Body body(skin);
+      body.writeProgram();
+
+      //fold the per-thread records into one result per stage
+      std::map< std::string, BenchResult > stageTotals;
+      std::vector< std::string > stageOrder;
+      const std::vector< StatRecord > &records = Stats::get_records();
+
+      for(std::vector< StatRecord >::const_iterator record_it = records.begin(); record_it != records.end(); record_it++)
+      {
+         if(stageTotals.find(record_it->stage) == stageTotals.end())
+         {
+            BenchResult result = {numThreads, record_it->stage, 0.0, 0, 0};
+            stageTotals[record_it->stage] = result;
+            stageOrder.push_back(record_it->stage);
+         }
+
+         BenchResult &result = stageTotals[record_it->stage];
+         result.wallTime += record_it->wallTime;
+         result.allocations += record_it->allocations;
+         result.rssGrowth += record_it->rssGrowth;
+
+         if(record_it->stage == "spinalColumn")
+            instructionsPerRun[numThreads] += record_it->instructions;
+      }
+
+      for(std::vector< std::string >::iterator stage_it = stageOrder.begin(); stage_it != stageOrder.end(); stage_it++)
+         results.push_back(stageTotals[*stage_it]);
+
+      delete config;
+   }
+
+   //report -- every stage is normalized to the instructions the run generated
+   std::ostringstream csv;
+   csv << "threads,stage,wall_s,instructions,inst_per_s,allocations,rss_growth_kb\n";
+   csv << std::fixed << std::setprecision(6);
+
+   std::cout << "\n\n" << std::setw(8) << "threads" << std::setw(18) << "stage" << std::setw(14) << "wall (s)";
+   std::cout << std::setw(14) << "instructions" << std::setw(16) << "inst/s" << std::setw(14) << "allocations" << "\n";
+
+   for(std::vector< BenchResult >::iterator result_it = results.begin(); result_it != results.end(); result_it++)
+   {
+      UINT_64 instructions = instructionsPerRun[result_it->numThreads];
+      double rate = result_it->wallTime > 0.0 ? instructions / result_it->wallTime : 0.0;
+
+      std::cout << std::setw(8) << result_it->numThreads << std::setw(18) << result_it->stage;
+      std::cout << std::setw(14) << std::fixed << std::setprecision(6) << result_it->wallTime;
+      std::cout << std::setw(14) << instructions << std::setw(16) << std::setprecision(0) << rate;
+      std::cout << std::setw(14) << result_it->allocations << "\n";
+
+      csv << result_it->numThreads << "," << result_it->stage << "," << result_it->wallTime << ",";
+      csv << instructions << "," << rate << "," << result_it->allocations << "," << result_it->rssGrowth << "\n";
+   }
+
+   if(!reportName.empty())
+   {
+      std::ofstream reportFile(reportName.c_str(), std::ios::trunc);
+      if(!reportFile)
+      {
+         std::cerr << "Error opening report file " << reportName << ".\n";
+         return 1;
+      }
+      reportFile << csv.str();
+      std::cout << "Results written to " << reportName << std::endl;
+   }
+
+   return 0;
+}
@@ -0,0 +1,310 @@
+//  This file was automatically generated.
+//  Do not edit this file.
+//
+//
+/// @file param_prog.c
+/// @author IDEAL Lab, University of Florida
+/// @author Clay Hughes, James Poe, and Tao Li
+//
+// Copyright: See COPYING file that comes with this distribution
+//
+///////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "sescapi.h"
+
+#define LOOP_0 1
+#define LOOP_1 1
+
+#define BEGIN_TRANSACTION(n) do {			\
+        __asm__ __volatile__ (".word 0x70000000+" #n);	\
+} while (0)
+
+#define COMMIT_TRANSACTION(n) do {			\
+        __asm__ __volatile__ (".word 0x7C000000+" #n);	\
+} while (0)
+
+/* Set Barrier */
+sbarrier_t paramBarr;
+
+/* Initialize Shared Memory Region */
+int* shared_memInt;
+register int s_data_out_int asm("22");
+
+int s_data_out_int_base;
+#include "a.in_1.h"
+
+
+int main()
+{
+   register int r_out_t0 asm("8");
+   register int r_out_t1 asm("9");
+   register int r_out_t2 asm("10");
+   register int r_out_t3 asm("11");
+   register int r_out_t4 asm("12");
+   register int r_out_t5 asm("13");
+   register int r_out_s0 asm("16");
+   register int r_out_s1 asm("17");
+   register int r_out_s2 asm("18");
+   register int r_out_s3 asm("19");
+   register int r_out_s4 asm("20");
+   register int r_out_s5 asm("21");
+   register int r_out_f2 asm("$f2");
+   register int r_out_f4 asm("$f4");
+   register int r_out_f6 asm("$f6");
+   register int r_out_f8 asm("$f8");
+   register int r_out_f10 asm("$f10");
+   register int r_out_f12 asm("$f12");
+
+   register int data_out_int asm("20");
+   register int data_out_float asm("21");
+   register int cell_counter asm("23");		//inner loop counter
+   register int block_counter asm("14");		//outer loop counter
+   register int nest_counter asm("24");		//nested cell loop counter
+
+   /* Set Loop */
+   unsigned int counter;
+
+   /* Initialize Private Memory Region */
+   int* memInt;
+   int data_out_int_base;
+
+   memInt           = (int*)malloc(sizeof(int) * 262144);
+   data_out_int     = (int)&(memInt[0]);
+
+   shared_memInt    = (int*)malloc(sizeof(int) * 262144);
+   s_data_out_int   = (int)&(shared_memInt[0]);
+
+   s_data_out_int_base = s_data_out_int;
+   data_out_int_base = data_out_int;
+
+   //spawn threads
+   sesc_spawn(threadFunc1, NULL, 0);
+
+   for(counter = 0; counter < LOOP_0; counter++)
+   {
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_0_0_:");
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 10"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_0_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "b I0_1_  "	 : : );
+
+   __asm__ __volatile__ ("I0_1_:");
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t3) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s1) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f4) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s0) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s1) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f6) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s1) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f10), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t2) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f10), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I0_2_  "	 : : );
+
+   __asm__ __volatile__ ("I0_2_:");
+   }	//end LOOP
+
+   sesc_wait();
+   sesc_wait();
+
+
+   return 0;
+}
@@ -0,0 +1,685 @@
+//  This file was automatically generated.
+//  Do not edit this file.
+//
+//
+/// @file param_prog_1.h
+/// @author IDEAL Lab, University of Florida
+/// @author Clay Hughes, James Poe, and Tao Li
+//
+// Copyright: See COPYING file that comes with this distribution
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+
+void threadFunc1(void *ptr)
+{
+   register int r_out_t0 asm("8");
+   register int r_out_t1 asm("9");
+   register int r_out_t2 asm("10");
+   register int r_out_t3 asm("11");
+   register int r_out_t4 asm("12");
+   register int r_out_t5 asm("13");
+   register int r_out_s0 asm("16");
+   register int r_out_s1 asm("17");
+   register int r_out_s2 asm("18");
+   register int r_out_s3 asm("19");
+   register int r_out_s4 asm("20");
+   register int r_out_s5 asm("21");
+   register int r_out_f2 asm("$f2");
+   register int r_out_f4 asm("$f4");
+   register int r_out_f6 asm("$f6");
+   register int r_out_f8 asm("$f8");
+   register int r_out_f10 asm("$f10");
+   register int r_out_f12 asm("$f12");
+
+   register int data_out_int asm("20");
+   register int data_out_float asm("21");
+   register int cell_counter asm("23");		//inner loop counter
+   register int block_counter asm("14");		//outer loop counter
+   register int nest_counter asm("24");		//nested cell loop counter
+
+   /* Set Loop */
+   unsigned int counter;
+
+   /* Initialize Private Memory Region */
+   int* memInt;
+
+   memInt         = (int*)malloc(sizeof(int) * 262144);
+   data_out_int   = (int)&(memInt[0]);
+
+   int data_out_int_base = data_out_int;
+
+   for(counter = 0; counter < LOOP_1; counter++)
+   {
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_1_0_:");
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 4(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 8(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 12(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 16(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 20(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 24(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 28(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 4(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 36(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f10), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 40(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 44(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "sw %1, 8(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 48(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 12(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 52(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "sw %1, 16(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f4) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 56(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 20(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s1) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 24(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 60(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f2) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 68(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 72(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 76(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 80(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s0) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "sw %1, 28(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 36(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 84(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 40(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 88(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 92(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 100(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 104(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 108(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 112(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 116(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 120(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 124(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 44(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 4"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_1_0_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "b I1_1_  "	 : : );
+
+   __asm__ __volatile__ ("I1_1_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ("LOOP_START_1_1_:");
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s1) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 4(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 8(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 12(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 16(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s0) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 4(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 20(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 8(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 4(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t2) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 24(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 28(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f6) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "sw %1, 8(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 8(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "sw %1, 12(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "sw %1, 16(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 6"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_1_1_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I1_2_  "	 : : );
+
+   __asm__ __volatile__ ("I1_2_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_1_2_:");
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 4(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 8(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 12(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 16(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 20(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 4(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 24(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 28(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 36(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 8(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "sw %1, 12(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 40(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s1) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 44(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 48(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 16(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 52(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s0) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 20(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 24(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 56(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 28(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 60(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 68(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 72(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "sw %1, 36(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 76(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 80(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 84(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 40(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 44(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 88(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 92(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 100(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s1) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 104(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 108(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 112(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 116(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 120(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 48(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s1) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 124(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f8) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 52(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 56(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 132(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f6) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "sw %1, 60(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 136(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 140(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 144(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 148(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 152(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 156(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s1) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 164(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "sw %1, 68(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 168(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 72(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 172(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 176(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 180(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 184(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s0) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 188(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "sw %1, 76(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 196(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 200(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 204(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 80(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 84(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s0) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 60(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f4) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 208(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 212(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 216(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 4(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 220(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 88(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 92(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 228(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 232(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 236(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 240(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 244(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s1) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 248(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s0) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 252(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s0) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 100(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 104(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 260(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 264(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 268(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 272(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 276(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 280(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "sw %1, 108(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 112(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 284(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 292(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 296(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 300(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 304(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 308(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 312(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 316(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 84(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 7"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_1_2_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "lw %0, 316(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 216(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "b I1_3_  "	 : : );
+
+   __asm__ __volatile__ ("I1_3_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ("LOOP_START_1_3_:");
+   __asm__ __volatile__ ( "lw %0, 12(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 16(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 20(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 24(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 16(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 28(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 20(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 36(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s0) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 4(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "sw %1, 24(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 40(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 8(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 12(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 44(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 28(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 16(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 48(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 52(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "sw %1, 36(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 56(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 20(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 60(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 68(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 40(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 4(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 72(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f8) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s1) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 76(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 80(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 24(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 84(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 28(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 88(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s0) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 92(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f8) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 8(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 8"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_1_3_" : :"r"(r_out_t0) );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I1_4_  "	 : : );
+
+   __asm__ __volatile__ ("I1_4_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_1_4_:");
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 4(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 4(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 8(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 8(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 12(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 16(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 12(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 20(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 24(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 28(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 36(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 40(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 44(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f8) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 48(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 16(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 3"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_1_4_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "b I1_5_  "	 : : );
+
+   __asm__ __volatile__ ("I1_5_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ("LOOP_START_1_5_:");
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f8) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 4(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 8(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 4(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 12(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 16(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 8(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 3"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_1_5_" : :"r"(r_out_t0) );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I1_6_  "	 : : );
+
+   __asm__ __volatile__ ("I1_6_:");
+   }	//end LOOP
+
+}
@@ -0,0 +1,1454 @@
+//  This file was automatically generated.
+//  Do not edit this file.
+//
+//
+/// @file param_prog.c
+/// @author IDEAL Lab, University of Florida
+/// @author Clay Hughes, James Poe, and Tao Li
+//
+// Copyright: See COPYING file that comes with this distribution
+//
+///////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "sescapi.h"
+
+#define LOOP_0 1
+
+#define BEGIN_TRANSACTION(n) do {			\
+        __asm__ __volatile__ (".word 0x70000000+" #n);	\
+} while (0)
+
+#define COMMIT_TRANSACTION(n) do {			\
+        __asm__ __volatile__ (".word 0x7C000000+" #n);	\
+} while (0)
+
+/* Set Barrier */
+sbarrier_t paramBarr;
+
+/* Initialize Shared Memory Region */
+int* shared_memInt;
+register int s_data_out_int asm("22");
+
+int s_data_out_int_base;
+
+
+int main()
+{
+   register int r_out_t0 asm("8");
+   register int r_out_t1 asm("9");
+   register int r_out_t2 asm("10");
+   register int r_out_t3 asm("11");
+   register int r_out_t4 asm("12");
+   register int r_out_t5 asm("13");
+   register int r_out_s0 asm("16");
+   register int r_out_s1 asm("17");
+   register int r_out_s2 asm("18");
+   register int r_out_s3 asm("19");
+   register int r_out_s4 asm("20");
+   register int r_out_s5 asm("21");
+   register int r_out_f2 asm("$f2");
+   register int r_out_f4 asm("$f4");
+   register int r_out_f6 asm("$f6");
+   register int r_out_f8 asm("$f8");
+   register int r_out_f10 asm("$f10");
+   register int r_out_f12 asm("$f12");
+
+   register int data_out_int asm("20");
+   register int data_out_float asm("21");
+   register int cell_counter asm("23");		//inner loop counter
+   register int block_counter asm("14");		//outer loop counter
+   register int nest_counter asm("24");		//nested cell loop counter
+
+   /* Set Loop */
+   unsigned int counter;
+
+   /* Initialize Private Memory Region */
+   int* memInt;
+   int data_out_int_base;
+
+   memInt           = (int*)malloc(sizeof(int) * 262144);
+   data_out_int     = (int)&(memInt[0]);
+
+   shared_memInt    = (int*)malloc(sizeof(int) * 262144);
+   s_data_out_int   = (int)&(shared_memInt[0]);
+
+   s_data_out_int_base = s_data_out_int;
+   data_out_int_base = data_out_int;
+
+   //spawn threads
+
+   for(counter = 0; counter < LOOP_0; counter++)
+   {
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_0_0_:");
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f10), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s3) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 3"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_0_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "b I0_1_  "	 : : );
+
+   __asm__ __volatile__ ("I0_1_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ("LOOP_START_0_1_:");
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f10), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f10), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s1) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f4) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 224(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 3"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_1_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_t2)  );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I0_2_  "	 : : );
+
+   __asm__ __volatile__ ("I0_2_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_0_2_:");
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s2) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t3) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 3"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_2_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "b I0_3_  "	 : : );
+
+   __asm__ __volatile__ ("I0_3_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ("LOOP_START_0_3_:");
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f10), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 640(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f4) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f2) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f10), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f6) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s3) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s0) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s1) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 3"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_3_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 672(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 704(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 224(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 256(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 288(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 480(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I0_4_  "	 : : );
+
+   __asm__ __volatile__ ("I0_4_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_0_4_:");
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f6) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t4) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f4) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s1) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s1) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f8) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 3"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_4_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "b I0_5_  "	 : : );
+
+   __asm__ __volatile__ ("I0_5_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ("LOOP_START_0_5_:");
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s1) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 224(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "sw %1, 768(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f10), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 256(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 640(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 672(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 704(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 288(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 320(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 736(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 352(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s0) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 768(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 800(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 832(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 864(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 672(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 896(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 928(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 384(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 416(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 448(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 3"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_5_" : :"r"(r_out_t0) );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I0_6_  "	 : : );
+
+   __asm__ __volatile__ ("I0_6_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_0_6_:");
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f6) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f10), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f2) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f2) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s0) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s1) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s0) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 3"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_6_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "b I0_7_  "	 : : );
+
+   __asm__ __volatile__ ("I0_7_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ( "lw %0, 800(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ("LOOP_START_0_7_:");
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f2) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 832(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f4) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 864(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 896(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 928(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 960(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 992(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s2) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "sw %1, 1024(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 1056(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f8) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 1088(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 1120(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 1152(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 1184(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 1216(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 1248(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 1280(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 1312(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 1344(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 1376(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 1408(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 1440(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 1472(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 1504(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 1536(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s1) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 1568(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 1600(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 1632(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 1664(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 1696(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 1728(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 1760(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 1792(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 1824(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 1856(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 1888(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s0) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 1920(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 1952(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 1984(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 2016(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 3"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_7_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "sw %1, 800(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I0_8_  "	 : : );
+
+   __asm__ __volatile__ ("I0_8_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_0_8_:");
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s1) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s1) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s0) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 3"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_8_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "b I0_9_  "	 : : );
+
+   __asm__ __volatile__ ("I0_9_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ("LOOP_START_0_9_:");
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s1) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 2080(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 2048(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 2080(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f8) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 2112(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f10), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f8) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f6) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 2112(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 2144(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 2176(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 224(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s1) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t2) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "sw %1, 256(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 3"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_9_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I0_10_  "	 : : );
+
+   __asm__ __volatile__ ("I0_10_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_0_10_:");
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t4) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f10), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f6) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s1) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f2) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 3"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_10_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "b I0_11_  "	 : : );
+
+   __asm__ __volatile__ ("I0_11_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ( "lw %0, 2208(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ("LOOP_START_0_11_:");
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s0) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f4) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s1) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f8) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 640(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f4) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 672(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 704(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 736(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 768(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f8) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 3"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_11_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 224(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 256(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 288(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 320(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 352(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 2208(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I0_12_  "	 : : );
+
+   __asm__ __volatile__ ("I0_12_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_0_12_:");
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f2) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s1) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s0) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f6) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f10), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 3"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_12_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "b I0_13_  "	 : : );
+
+   __asm__ __volatile__ ("I0_13_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ("LOOP_START_0_13_:");
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 2240(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 2272(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 2272(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 2304(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 2336(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 2368(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "sw %1, 2304(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 2336(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 2400(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f6) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 2432(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 2368(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 2400(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f6) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "sw %1, 2432(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 2464(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 2496(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 2528(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "sw %1, 2464(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 2496(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s2) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f2) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 2560(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 2592(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 2624(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 2656(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 2528(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f2) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 2688(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 2720(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 2752(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f2) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 2784(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 2816(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 2848(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 2880(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 2560(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 2592(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 2912(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 2944(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "sw %1, 2624(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 3"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_13_" : :"r"(r_out_t0) );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I0_14_  "	 : : );
+
+   __asm__ __volatile__ ("I0_14_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_0_14_:");
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f4) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t2) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f8) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s1) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 3"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_14_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "b I0_15_  "	 : : );
+
+   __asm__ __volatile__ ("I0_15_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ( "lw %0, 2976(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ("LOOP_START_0_15_:");
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 3008(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 3040(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 3072(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 3104(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 224(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "sw %1, 256(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 3136(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "sw %1, 288(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 3168(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 640(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 672(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 704(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 3200(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 3232(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 736(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f10), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "sw %1, 320(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 3264(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 352(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 3296(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 768(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 3328(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 800(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 384(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 832(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 416(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 3"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_15_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "sw %1, 2976(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I0_16_  "	 : : );
+
+   __asm__ __volatile__ ("I0_16_:");
+   }	//end LOOP
+
+   sesc_wait();
+
+
+   return 0;
+}
@@ -0,0 +1,6415 @@
+//  This file was automatically generated.
+//  Do not edit this file.
+//
+//
+/// @file param_prog.c
+/// @author IDEAL Lab, University of Florida
+/// @author Clay Hughes, James Poe, and Tao Li
+//
+// Copyright: See COPYING file that comes with this distribution
+//
+///////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "sescapi.h"
+
+#define LOOP_0 1
+#define LOOP_1 1
+#define LOOP_2 1
+#define LOOP_3 1
+#define LOOP_4 1
+#define LOOP_5 1
+#define LOOP_6 1
+#define LOOP_7 1
+#define LOOP_8 1
+#define LOOP_9 1
+#define LOOP_10 1
+#define LOOP_11 1
+#define LOOP_12 1
+#define LOOP_13 1
+#define LOOP_14 1
+#define LOOP_15 1
+#define LOOP_16 1
+#define LOOP_17 1
+#define LOOP_18 1
+#define LOOP_19 1
+#define LOOP_20 1
+#define LOOP_21 1
+#define LOOP_22 1
+#define LOOP_23 1
+#define LOOP_24 1
+#define LOOP_25 1
+#define LOOP_26 1
+#define LOOP_27 1
+#define LOOP_28 1
+#define LOOP_29 1
+#define LOOP_30 1
+#define LOOP_31 1
+#define LOOP_32 1
+#define LOOP_33 1
+#define LOOP_34 1
+#define LOOP_35 1
+#define LOOP_36 1
+#define LOOP_37 1
+#define LOOP_38 1
+#define LOOP_39 1
+#define LOOP_40 1
+#define LOOP_41 1
+#define LOOP_42 1
+#define LOOP_43 1
+#define LOOP_44 1
+#define LOOP_45 1
+#define LOOP_46 1
+#define LOOP_47 1
+#define LOOP_48 1
+#define LOOP_49 1
+#define LOOP_50 1
+#define LOOP_51 1
+#define LOOP_52 1
+#define LOOP_53 1
+#define LOOP_54 1
+#define LOOP_55 1
+#define LOOP_56 1
+#define LOOP_57 1
+#define LOOP_58 1
+#define LOOP_59 1
+#define LOOP_60 1
+#define LOOP_61 1
+#define LOOP_62 1
+#define LOOP_63 1
+#define LOOP_64 1
+#define LOOP_65 1
+#define LOOP_66 1
+#define LOOP_67 1
+#define LOOP_68 1
+#define LOOP_69 1
+#define LOOP_70 1
+#define LOOP_71 1
+#define LOOP_72 1
+#define LOOP_73 1
+#define LOOP_74 1
+#define LOOP_75 1
+#define LOOP_76 1
+#define LOOP_77 1
+#define LOOP_78 1
+#define LOOP_79 1
+#define LOOP_80 1
+#define LOOP_81 1
+#define LOOP_82 1
+#define LOOP_83 1
+#define LOOP_84 1
+#define LOOP_85 1
+#define LOOP_86 1
+#define LOOP_87 1
+#define LOOP_88 1
+#define LOOP_89 1
+#define LOOP_90 1
+#define LOOP_91 1
+#define LOOP_92 1
+#define LOOP_93 1
+#define LOOP_94 1
+#define LOOP_95 1
+#define LOOP_96 1
+#define LOOP_97 1
+#define LOOP_98 1
+#define LOOP_99 1
+#define LOOP_100 1
+#define LOOP_101 1
+#define LOOP_102 1
+#define LOOP_103 1
+#define LOOP_104 1
+#define LOOP_105 1
+#define LOOP_106 1
+#define LOOP_107 1
+#define LOOP_108 1
+#define LOOP_109 1
+#define LOOP_110 1
+#define LOOP_111 1
+#define LOOP_112 1
+#define LOOP_113 1
+#define LOOP_114 1
+#define LOOP_115 1
+#define LOOP_116 1
+#define LOOP_117 1
+#define LOOP_118 1
+#define LOOP_119 1
+#define LOOP_120 1
+#define LOOP_121 1
+#define LOOP_122 1
+#define LOOP_123 1
+#define LOOP_124 1
+#define LOOP_125 1
+#define LOOP_126 1
+#define LOOP_127 1
+#define LOOP_128 1
+#define LOOP_129 1
+#define LOOP_130 1
+#define LOOP_131 1
+#define LOOP_132 1
+#define LOOP_133 1
+#define LOOP_134 1
+#define LOOP_135 1
+#define LOOP_136 1
+#define LOOP_137 1
+#define LOOP_138 1
+#define LOOP_139 1
+#define LOOP_140 1
+#define LOOP_141 1
+#define LOOP_142 1
+#define LOOP_143 1
+#define LOOP_144 1
+#define LOOP_145 1
+#define LOOP_146 1
+#define LOOP_147 1
+#define LOOP_148 1
+#define LOOP_149 1
+#define LOOP_150 1
+#define LOOP_151 1
+#define LOOP_152 1
+#define LOOP_153 1
+#define LOOP_154 1
+#define LOOP_155 1
+#define LOOP_156 1
+#define LOOP_157 1
+#define LOOP_158 1
+#define LOOP_159 1
+#define LOOP_160 1
+#define LOOP_161 1
+#define LOOP_162 1
+#define LOOP_163 1
+#define LOOP_164 1
+#define LOOP_165 1
+#define LOOP_166 1
+#define LOOP_167 1
+#define LOOP_168 1
+#define LOOP_169 1
+#define LOOP_170 1
+#define LOOP_171 1
+#define LOOP_172 1
+#define LOOP_173 1
+#define LOOP_174 1
+#define LOOP_175 1
+#define LOOP_176 1
+#define LOOP_177 1
+#define LOOP_178 1
+#define LOOP_179 1
+#define LOOP_180 1
+#define LOOP_181 1
+#define LOOP_182 1
+#define LOOP_183 1
+#define LOOP_184 1
+#define LOOP_185 1
+#define LOOP_186 1
+#define LOOP_187 1
+#define LOOP_188 1
+#define LOOP_189 1
+#define LOOP_190 1
+#define LOOP_191 1
+#define LOOP_192 1
+#define LOOP_193 1
+#define LOOP_194 1
+#define LOOP_195 1
+#define LOOP_196 1
+#define LOOP_197 1
+#define LOOP_198 1
+#define LOOP_199 1
+#define LOOP_200 1
+#define LOOP_201 1
+#define LOOP_202 1
+#define LOOP_203 1
+#define LOOP_204 1
+#define LOOP_205 1
+#define LOOP_206 1
+#define LOOP_207 1
+#define LOOP_208 1
+#define LOOP_209 1
+#define LOOP_210 1
+#define LOOP_211 1
+#define LOOP_212 1
+#define LOOP_213 1
+#define LOOP_214 1
+#define LOOP_215 1
+#define LOOP_216 1
+#define LOOP_217 1
+#define LOOP_218 1
+#define LOOP_219 1
+#define LOOP_220 1
+#define LOOP_221 1
+#define LOOP_222 1
+#define LOOP_223 1
+#define LOOP_224 1
+#define LOOP_225 1
+#define LOOP_226 1
+#define LOOP_227 1
+#define LOOP_228 1
+#define LOOP_229 1
+#define LOOP_230 1
+#define LOOP_231 1
+#define LOOP_232 1
+#define LOOP_233 1
+#define LOOP_234 1
+#define LOOP_235 1
+#define LOOP_236 1
+#define LOOP_237 1
+#define LOOP_238 1
+#define LOOP_239 1
+#define LOOP_240 1
+#define LOOP_241 1
+#define LOOP_242 1
+#define LOOP_243 1
+#define LOOP_244 1
+#define LOOP_245 1
+#define LOOP_246 1
+#define LOOP_247 1
+#define LOOP_248 1
+#define LOOP_249 1
+#define LOOP_250 1
+#define LOOP_251 1
+#define LOOP_252 1
+#define LOOP_253 1
+#define LOOP_254 1
+#define LOOP_255 1
+#define LOOP_256 1
+#define LOOP_257 1
+#define LOOP_258 1
+#define LOOP_259 1
+#define LOOP_260 1
+#define LOOP_261 1
+#define LOOP_262 1
+#define LOOP_263 1
+#define LOOP_264 1
+#define LOOP_265 1
+#define LOOP_266 1
+#define LOOP_267 1
+#define LOOP_268 1
+#define LOOP_269 1
+#define LOOP_270 1
+#define LOOP_271 1
+#define LOOP_272 1
+#define LOOP_273 1
+#define LOOP_274 1
+#define LOOP_275 1
+#define LOOP_276 1
+#define LOOP_277 1
+#define LOOP_278 1
+#define LOOP_279 1
+#define LOOP_280 1
+#define LOOP_281 1
+#define LOOP_282 1
+#define LOOP_283 1
+#define LOOP_284 1
+#define LOOP_285 1
+#define LOOP_286 1
+#define LOOP_287 1
+#define LOOP_288 1
+#define LOOP_289 1
+#define LOOP_290 1
+#define LOOP_291 1
+#define LOOP_292 1
+#define LOOP_293 1
+#define LOOP_294 1
+#define LOOP_295 1
+#define LOOP_296 1
+#define LOOP_297 1
+#define LOOP_298 1
+#define LOOP_299 1
+#define LOOP_300 1
+#define LOOP_301 1
+#define LOOP_302 1
+#define LOOP_303 1
+#define LOOP_304 1
+#define LOOP_305 1
+#define LOOP_306 1
+#define LOOP_307 1
+#define LOOP_308 1
+#define LOOP_309 1
+#define LOOP_310 1
+#define LOOP_311 1
+#define LOOP_312 1
+#define LOOP_313 1
+#define LOOP_314 1
+#define LOOP_315 1
+#define LOOP_316 1
+#define LOOP_317 1
+#define LOOP_318 1
+#define LOOP_319 1
+#define LOOP_320 1
+#define LOOP_321 1
+#define LOOP_322 1
+#define LOOP_323 1
+#define LOOP_324 1
+#define LOOP_325 1
+#define LOOP_326 1
+#define LOOP_327 1
+#define LOOP_328 1
+#define LOOP_329 1
+#define LOOP_330 1
+#define LOOP_331 1
+#define LOOP_332 1
+#define LOOP_333 1
+#define LOOP_334 1
+#define LOOP_335 1
+#define LOOP_336 1
+#define LOOP_337 1
+#define LOOP_338 1
+#define LOOP_339 1
+#define LOOP_340 1
+#define LOOP_341 1
+#define LOOP_342 1
+#define LOOP_343 1
+#define LOOP_344 1
+#define LOOP_345 1
+#define LOOP_346 1
+#define LOOP_347 1
+#define LOOP_348 1
+#define LOOP_349 1
+#define LOOP_350 1
+#define LOOP_351 1
+#define LOOP_352 1
+#define LOOP_353 1
+#define LOOP_354 1
+#define LOOP_355 1
+#define LOOP_356 1
+#define LOOP_357 1
+#define LOOP_358 1
+#define LOOP_359 1
+#define LOOP_360 1
+#define LOOP_361 1
+#define LOOP_362 1
+#define LOOP_363 1
+#define LOOP_364 1
+#define LOOP_365 1
+#define LOOP_366 1
+#define LOOP_367 1
+#define LOOP_368 1
+#define LOOP_369 1
+#define LOOP_370 1
+#define LOOP_371 1
+#define LOOP_372 1
+#define LOOP_373 1
+#define LOOP_374 1
+#define LOOP_375 1
+#define LOOP_376 1
+#define LOOP_377 1
+#define LOOP_378 1
+#define LOOP_379 1
+#define LOOP_380 1
+#define LOOP_381 1
+#define LOOP_382 1
+#define LOOP_383 1
+#define LOOP_384 1
+#define LOOP_385 1
+#define LOOP_386 1
+#define LOOP_387 1
+#define LOOP_388 1
+#define LOOP_389 1
+#define LOOP_390 1
+#define LOOP_391 1
+#define LOOP_392 1
+#define LOOP_393 1
+#define LOOP_394 1
+#define LOOP_395 1
+#define LOOP_396 1
+#define LOOP_397 1
+#define LOOP_398 1
+#define LOOP_399 1
+#define LOOP_400 1
+#define LOOP_401 1
+#define LOOP_402 1
+#define LOOP_403 1
+#define LOOP_404 1
+#define LOOP_405 1
+#define LOOP_406 1
+#define LOOP_407 1
+#define LOOP_408 1
+#define LOOP_409 1
+#define LOOP_410 1
+#define LOOP_411 1
+#define LOOP_412 1
+#define LOOP_413 1
+#define LOOP_414 1
+#define LOOP_415 1
+#define LOOP_416 1
+#define LOOP_417 1
+#define LOOP_418 1
+#define LOOP_419 1
+#define LOOP_420 1
+#define LOOP_421 1
+#define LOOP_422 1
+#define LOOP_423 1
+#define LOOP_424 1
+#define LOOP_425 1
+#define LOOP_426 1
+#define LOOP_427 1
+#define LOOP_428 1
+#define LOOP_429 1
+#define LOOP_430 1
+#define LOOP_431 1
+#define LOOP_432 1
+#define LOOP_433 1
+#define LOOP_434 1
+#define LOOP_435 1
+#define LOOP_436 1
+#define LOOP_437 1
+#define LOOP_438 1
+#define LOOP_439 1
+#define LOOP_440 1
+#define LOOP_441 1
+#define LOOP_442 1
+#define LOOP_443 1
+#define LOOP_444 1
+#define LOOP_445 1
+#define LOOP_446 1
+#define LOOP_447 1
+#define LOOP_448 1
+#define LOOP_449 1
+#define LOOP_450 1
+#define LOOP_451 1
+#define LOOP_452 1
+#define LOOP_453 1
+#define LOOP_454 1
+#define LOOP_455 1
+#define LOOP_456 1
+#define LOOP_457 1
+#define LOOP_458 1
+#define LOOP_459 1
+#define LOOP_460 1
+#define LOOP_461 1
+#define LOOP_462 1
+#define LOOP_463 1
+#define LOOP_464 1
+#define LOOP_465 1
+#define LOOP_466 1
+#define LOOP_467 1
+#define LOOP_468 1
+#define LOOP_469 1
+#define LOOP_470 1
+#define LOOP_471 1
+#define LOOP_472 1
+#define LOOP_473 1
+#define LOOP_474 1
+#define LOOP_475 1
+#define LOOP_476 1
+#define LOOP_477 1
+#define LOOP_478 1
+#define LOOP_479 1
+#define LOOP_480 1
+#define LOOP_481 1
+#define LOOP_482 1
+#define LOOP_483 1
+#define LOOP_484 1
+#define LOOP_485 1
+#define LOOP_486 1
+#define LOOP_487 1
+#define LOOP_488 1
+#define LOOP_489 1
+#define LOOP_490 1
+#define LOOP_491 1
+#define LOOP_492 1
+#define LOOP_493 1
+#define LOOP_494 1
+#define LOOP_495 1
+#define LOOP_496 1
+#define LOOP_497 1
+#define LOOP_498 1
+#define LOOP_499 1
+#define LOOP_500 1
+#define LOOP_501 1
+#define LOOP_502 1
+#define LOOP_503 1
+#define LOOP_504 1
+#define LOOP_505 1
+#define LOOP_506 1
+#define LOOP_507 1
+#define LOOP_508 1
+#define LOOP_509 1
+#define LOOP_510 1
+#define LOOP_511 1
+#define LOOP_512 1
+#define LOOP_513 1
+#define LOOP_514 1
+#define LOOP_515 1
+#define LOOP_516 1
+#define LOOP_517 1
+#define LOOP_518 1
+#define LOOP_519 1
+#define LOOP_520 1
+#define LOOP_521 1
+#define LOOP_522 1
+#define LOOP_523 1
+#define LOOP_524 1
+#define LOOP_525 1
+#define LOOP_526 1
+#define LOOP_527 1
+#define LOOP_528 1
+#define LOOP_529 1
+#define LOOP_530 1
+#define LOOP_531 1
+#define LOOP_532 1
+#define LOOP_533 1
+#define LOOP_534 1
+#define LOOP_535 1
+#define LOOP_536 1
+#define LOOP_537 1
+#define LOOP_538 1
+#define LOOP_539 1
+#define LOOP_540 1
+#define LOOP_541 1
+#define LOOP_542 1
+#define LOOP_543 1
+#define LOOP_544 1
+#define LOOP_545 1
+#define LOOP_546 1
+#define LOOP_547 1
+#define LOOP_548 1
+#define LOOP_549 1
+#define LOOP_550 1
+#define LOOP_551 1
+#define LOOP_552 1
+#define LOOP_553 1
+#define LOOP_554 1
+#define LOOP_555 1
+#define LOOP_556 1
+#define LOOP_557 1
+#define LOOP_558 1
+#define LOOP_559 1
+#define LOOP_560 1
+#define LOOP_561 1
+#define LOOP_562 1
+#define LOOP_563 1
+#define LOOP_564 1
+#define LOOP_565 1
+#define LOOP_566 1
+#define LOOP_567 1
+#define LOOP_568 1
+#define LOOP_569 1
+#define LOOP_570 1
+#define LOOP_571 1
+#define LOOP_572 1
+#define LOOP_573 1
+#define LOOP_574 1
+#define LOOP_575 1
+#define LOOP_576 1
+#define LOOP_577 1
+#define LOOP_578 1
+#define LOOP_579 1
+#define LOOP_580 1
+#define LOOP_581 1
+#define LOOP_582 1
+#define LOOP_583 1
+#define LOOP_584 1
+#define LOOP_585 1
+#define LOOP_586 1
+#define LOOP_587 1
+#define LOOP_588 1
+#define LOOP_589 1
+#define LOOP_590 1
+#define LOOP_591 1
+#define LOOP_592 1
+#define LOOP_593 1
+#define LOOP_594 1
+#define LOOP_595 1
+#define LOOP_596 1
+#define LOOP_597 1
+#define LOOP_598 1
+#define LOOP_599 1
+#define LOOP_600 1
+#define LOOP_601 1
+#define LOOP_602 1
+#define LOOP_603 1
+#define LOOP_604 1
+#define LOOP_605 1
+#define LOOP_606 1
+#define LOOP_607 1
+#define LOOP_608 1
+#define LOOP_609 1
+#define LOOP_610 1
+#define LOOP_611 1
+#define LOOP_612 1
+#define LOOP_613 1
+#define LOOP_614 1
+#define LOOP_615 1
+#define LOOP_616 1
+#define LOOP_617 1
+#define LOOP_618 1
+#define LOOP_619 1
+#define LOOP_620 1
+#define LOOP_621 1
+#define LOOP_622 1
+#define LOOP_623 1
+#define LOOP_624 1
+#define LOOP_625 1
+#define LOOP_626 1
+#define LOOP_627 1
+#define LOOP_628 1
+#define LOOP_629 1
+#define LOOP_630 1
+#define LOOP_631 1
+#define LOOP_632 1
+#define LOOP_633 1
+#define LOOP_634 1
+#define LOOP_635 1
+#define LOOP_636 1
+#define LOOP_637 1
+#define LOOP_638 1
+#define LOOP_639 1
+#define LOOP_640 1
+#define LOOP_641 1
+#define LOOP_642 1
+#define LOOP_643 1
+#define LOOP_644 1
+#define LOOP_645 1
+#define LOOP_646 1
+#define LOOP_647 1
+#define LOOP_648 1
+#define LOOP_649 1
+#define LOOP_650 1
+#define LOOP_651 1
+#define LOOP_652 1
+#define LOOP_653 1
+#define LOOP_654 1
+#define LOOP_655 1
+#define LOOP_656 1
+#define LOOP_657 1
+#define LOOP_658 1
+#define LOOP_659 1
+#define LOOP_660 1
+#define LOOP_661 1
+#define LOOP_662 1
+#define LOOP_663 1
+#define LOOP_664 1
+#define LOOP_665 1
+#define LOOP_666 1
+#define LOOP_667 1
+#define LOOP_668 1
+#define LOOP_669 1
+#define LOOP_670 1
+#define LOOP_671 1
+#define LOOP_672 1
+#define LOOP_673 1
+#define LOOP_674 1
+#define LOOP_675 1
+#define LOOP_676 1
+#define LOOP_677 1
+#define LOOP_678 1
+#define LOOP_679 1
+#define LOOP_680 1
+#define LOOP_681 1
+#define LOOP_682 1
+#define LOOP_683 1
+#define LOOP_684 1
+#define LOOP_685 1
+#define LOOP_686 1
+#define LOOP_687 1
+#define LOOP_688 1
+#define LOOP_689 1
+#define LOOP_690 1
+#define LOOP_691 1
+#define LOOP_692 1
+#define LOOP_693 1
+#define LOOP_694 1
+#define LOOP_695 1
+#define LOOP_696 1
+#define LOOP_697 1
+#define LOOP_698 1
+#define LOOP_699 1
+#define LOOP_700 1
+#define LOOP_701 1
+#define LOOP_702 1
+#define LOOP_703 1
+#define LOOP_704 1
+#define LOOP_705 1
+#define LOOP_706 1
+#define LOOP_707 1
+#define LOOP_708 1
+#define LOOP_709 1
+#define LOOP_710 1
+#define LOOP_711 1
+#define LOOP_712 1
+#define LOOP_713 1
+#define LOOP_714 1
+#define LOOP_715 1
+#define LOOP_716 1
+#define LOOP_717 1
+#define LOOP_718 1
+#define LOOP_719 1
+#define LOOP_720 1
+#define LOOP_721 1
+#define LOOP_722 1
+#define LOOP_723 1
+#define LOOP_724 1
+#define LOOP_725 1
+#define LOOP_726 1
+#define LOOP_727 1
+#define LOOP_728 1
+#define LOOP_729 1
+#define LOOP_730 1
+#define LOOP_731 1
+#define LOOP_732 1
+#define LOOP_733 1
+#define LOOP_734 1
+#define LOOP_735 1
+#define LOOP_736 1
+#define LOOP_737 1
+#define LOOP_738 1
+#define LOOP_739 1
+#define LOOP_740 1
+#define LOOP_741 1
+#define LOOP_742 1
+#define LOOP_743 1
+#define LOOP_744 1
+#define LOOP_745 1
+#define LOOP_746 1
+#define LOOP_747 1
+#define LOOP_748 1
+#define LOOP_749 1
+#define LOOP_750 1
+#define LOOP_751 1
+#define LOOP_752 1
+#define LOOP_753 1
+#define LOOP_754 1
+#define LOOP_755 1
+#define LOOP_756 1
+#define LOOP_757 1
+#define LOOP_758 1
+#define LOOP_759 1
+#define LOOP_760 1
+#define LOOP_761 1
+#define LOOP_762 1
+#define LOOP_763 1
+#define LOOP_764 1
+#define LOOP_765 1
+#define LOOP_766 1
+#define LOOP_767 1
+#define LOOP_768 1
+#define LOOP_769 1
+#define LOOP_770 1
+#define LOOP_771 1
+#define LOOP_772 1
+#define LOOP_773 1
+#define LOOP_774 1
+#define LOOP_775 1
+#define LOOP_776 1
+#define LOOP_777 1
+#define LOOP_778 1
+#define LOOP_779 1
+#define LOOP_780 1
+#define LOOP_781 1
+#define LOOP_782 1
+#define LOOP_783 1
+#define LOOP_784 1
+#define LOOP_785 1
+#define LOOP_786 1
+#define LOOP_787 1
+#define LOOP_788 1
+#define LOOP_789 1
+#define LOOP_790 1
+#define LOOP_791 1
+#define LOOP_792 1
+#define LOOP_793 1
+#define LOOP_794 1
+#define LOOP_795 1
+#define LOOP_796 1
+#define LOOP_797 1
+#define LOOP_798 1
+#define LOOP_799 1
+#define LOOP_800 1
+#define LOOP_801 1
+#define LOOP_802 1
+#define LOOP_803 1
+#define LOOP_804 1
+#define LOOP_805 1
+#define LOOP_806 1
+#define LOOP_807 1
+#define LOOP_808 1
+#define LOOP_809 1
+#define LOOP_810 1
+#define LOOP_811 1
+#define LOOP_812 1
+#define LOOP_813 1
+#define LOOP_814 1
+#define LOOP_815 1
+#define LOOP_816 1
+#define LOOP_817 1
+#define LOOP_818 1
+#define LOOP_819 1
+#define LOOP_820 1
+#define LOOP_821 1
+#define LOOP_822 1
+#define LOOP_823 1
+#define LOOP_824 1
+#define LOOP_825 1
+#define LOOP_826 1
+#define LOOP_827 1
+#define LOOP_828 1
+#define LOOP_829 1
+#define LOOP_830 1
+#define LOOP_831 1
+#define LOOP_832 1
+#define LOOP_833 1
+#define LOOP_834 1
+#define LOOP_835 1
+#define LOOP_836 1
+#define LOOP_837 1
+#define LOOP_838 1
+#define LOOP_839 1
+#define LOOP_840 1
+#define LOOP_841 1
+#define LOOP_842 1
+#define LOOP_843 1
+#define LOOP_844 1
+#define LOOP_845 1
+#define LOOP_846 1
+#define LOOP_847 1
+#define LOOP_848 1
+#define LOOP_849 1
+#define LOOP_850 1
+#define LOOP_851 1
+#define LOOP_852 1
+#define LOOP_853 1
+#define LOOP_854 1
+#define LOOP_855 1
+#define LOOP_856 1
+#define LOOP_857 1
+#define LOOP_858 1
+#define LOOP_859 1
+#define LOOP_860 1
+#define LOOP_861 1
+#define LOOP_862 1
+#define LOOP_863 1
+#define LOOP_864 1
+#define LOOP_865 1
+#define LOOP_866 1
+#define LOOP_867 1
+#define LOOP_868 1
+#define LOOP_869 1
+#define LOOP_870 1
+#define LOOP_871 1
+#define LOOP_872 1
+#define LOOP_873 1
+#define LOOP_874 1
+#define LOOP_875 1
+#define LOOP_876 1
+#define LOOP_877 1
+#define LOOP_878 1
+#define LOOP_879 1
+#define LOOP_880 1
+#define LOOP_881 1
+#define LOOP_882 1
+#define LOOP_883 1
+#define LOOP_884 1
+#define LOOP_885 1
+#define LOOP_886 1
+#define LOOP_887 1
+#define LOOP_888 1
+#define LOOP_889 1
+#define LOOP_890 1
+#define LOOP_891 1
+#define LOOP_892 1
+#define LOOP_893 1
+#define LOOP_894 1
+#define LOOP_895 1
+#define LOOP_896 1
+#define LOOP_897 1
+#define LOOP_898 1
+#define LOOP_899 1
+#define LOOP_900 1
+#define LOOP_901 1
+#define LOOP_902 1
+#define LOOP_903 1
+#define LOOP_904 1
+#define LOOP_905 1
+#define LOOP_906 1
+#define LOOP_907 1
+#define LOOP_908 1
+#define LOOP_909 1
+#define LOOP_910 1
+#define LOOP_911 1
+#define LOOP_912 1
+#define LOOP_913 1
+#define LOOP_914 1
+#define LOOP_915 1
+#define LOOP_916 1
+#define LOOP_917 1
+#define LOOP_918 1
+#define LOOP_919 1
+#define LOOP_920 1
+#define LOOP_921 1
+#define LOOP_922 1
+#define LOOP_923 1
+#define LOOP_924 1
+#define LOOP_925 1
+#define LOOP_926 1
+#define LOOP_927 1
+#define LOOP_928 1
+#define LOOP_929 1
+#define LOOP_930 1
+#define LOOP_931 1
+#define LOOP_932 1
+#define LOOP_933 1
+#define LOOP_934 1
+#define LOOP_935 1
+#define LOOP_936 1
+#define LOOP_937 1
+#define LOOP_938 1
+#define LOOP_939 1
+#define LOOP_940 1
+#define LOOP_941 1
+#define LOOP_942 1
+#define LOOP_943 1
+#define LOOP_944 1
+#define LOOP_945 1
+#define LOOP_946 1
+#define LOOP_947 1
+#define LOOP_948 1
+#define LOOP_949 1
+#define LOOP_950 1
+#define LOOP_951 1
+#define LOOP_952 1
+#define LOOP_953 1
+#define LOOP_954 1
+#define LOOP_955 1
+#define LOOP_956 1
+#define LOOP_957 1
+#define LOOP_958 1
+#define LOOP_959 1
+#define LOOP_960 1
+#define LOOP_961 1
+#define LOOP_962 1
+#define LOOP_963 1
+#define LOOP_964 1
+#define LOOP_965 1
+#define LOOP_966 1
+#define LOOP_967 1
+#define LOOP_968 1
+#define LOOP_969 1
+#define LOOP_970 1
+#define LOOP_971 1
+#define LOOP_972 1
+#define LOOP_973 1
+#define LOOP_974 1
+#define LOOP_975 1
+#define LOOP_976 1
+#define LOOP_977 1
+#define LOOP_978 1
+#define LOOP_979 1
+#define LOOP_980 1
+#define LOOP_981 1
+#define LOOP_982 1
+#define LOOP_983 1
+#define LOOP_984 1
+#define LOOP_985 1
+#define LOOP_986 1
+#define LOOP_987 1
+#define LOOP_988 1
+#define LOOP_989 1
+#define LOOP_990 1
+#define LOOP_991 1
+#define LOOP_992 1
+#define LOOP_993 1
+#define LOOP_994 1
+#define LOOP_995 1
+#define LOOP_996 1
+#define LOOP_997 1
+#define LOOP_998 1
+#define LOOP_999 1
+#define LOOP_1000 1
+#define LOOP_1001 1
+#define LOOP_1002 1
+#define LOOP_1003 1
+#define LOOP_1004 1
+#define LOOP_1005 1
+#define LOOP_1006 1
+#define LOOP_1007 1
+#define LOOP_1008 1
+#define LOOP_1009 1
+#define LOOP_1010 1
+#define LOOP_1011 1
+#define LOOP_1012 1
+#define LOOP_1013 1
+#define LOOP_1014 1
+#define LOOP_1015 1
+#define LOOP_1016 1
+#define LOOP_1017 1
+#define LOOP_1018 1
+#define LOOP_1019 1
+#define LOOP_1020 1
+#define LOOP_1021 1
+#define LOOP_1022 1
+#define LOOP_1023 1
+
+#define BEGIN_TRANSACTION(n) do {			\
+        __asm__ __volatile__ (".word 0x70000000+" #n);	\
+} while (0)
+
+#define COMMIT_TRANSACTION(n) do {			\
+        __asm__ __volatile__ (".word 0x7C000000+" #n);	\
+} while (0)
+
+/* Set Barrier */
+sbarrier_t paramBarr;
+
+/* Initialize Shared Memory Region */
+int* shared_memInt;
+register int s_data_out_int asm("22");
+
+int s_data_out_int_base;
+#include "bench_T1024.in_1.h"
+#include "bench_T1024.in_2.h"
+#include "bench_T1024.in_3.h"
+#include "bench_T1024.in_4.h"
+#include "bench_T1024.in_5.h"
+#include "bench_T1024.in_6.h"
+#include "bench_T1024.in_7.h"
+#include "bench_T1024.in_8.h"
+#include "bench_T1024.in_9.h"
+#include "bench_T1024.in_10.h"
+#include "bench_T1024.in_11.h"
+#include "bench_T1024.in_12.h"
+#include "bench_T1024.in_13.h"
+#include "bench_T1024.in_14.h"
+#include "bench_T1024.in_15.h"
+#include "bench_T1024.in_16.h"
+#include "bench_T1024.in_17.h"
+#include "bench_T1024.in_18.h"
+#include "bench_T1024.in_19.h"
+#include "bench_T1024.in_20.h"
+#include "bench_T1024.in_21.h"
+#include "bench_T1024.in_22.h"
+#include "bench_T1024.in_23.h"
+#include "bench_T1024.in_24.h"
+#include "bench_T1024.in_25.h"
+#include "bench_T1024.in_26.h"
+#include "bench_T1024.in_27.h"
+#include "bench_T1024.in_28.h"
+#include "bench_T1024.in_29.h"
+#include "bench_T1024.in_30.h"
+#include "bench_T1024.in_31.h"
+#include "bench_T1024.in_32.h"
+#include "bench_T1024.in_33.h"
+#include "bench_T1024.in_34.h"
+#include "bench_T1024.in_35.h"
+#include "bench_T1024.in_36.h"
+#include "bench_T1024.in_37.h"
+#include "bench_T1024.in_38.h"
+#include "bench_T1024.in_39.h"
+#include "bench_T1024.in_40.h"
+#include "bench_T1024.in_41.h"
+#include "bench_T1024.in_42.h"
+#include "bench_T1024.in_43.h"
+#include "bench_T1024.in_44.h"
+#include "bench_T1024.in_45.h"
+#include "bench_T1024.in_46.h"
+#include "bench_T1024.in_47.h"
+#include "bench_T1024.in_48.h"
+#include "bench_T1024.in_49.h"
+#include "bench_T1024.in_50.h"
+#include "bench_T1024.in_51.h"
+#include "bench_T1024.in_52.h"
+#include "bench_T1024.in_53.h"
+#include "bench_T1024.in_54.h"
+#include "bench_T1024.in_55.h"
+#include "bench_T1024.in_56.h"
+#include "bench_T1024.in_57.h"
+#include "bench_T1024.in_58.h"
+#include "bench_T1024.in_59.h"
+#include "bench_T1024.in_60.h"
+#include "bench_T1024.in_61.h"
+#include "bench_T1024.in_62.h"
+#include "bench_T1024.in_63.h"
+#include "bench_T1024.in_64.h"
+#include "bench_T1024.in_65.h"
+#include "bench_T1024.in_66.h"
+#include "bench_T1024.in_67.h"
+#include "bench_T1024.in_68.h"
+#include "bench_T1024.in_69.h"
+#include "bench_T1024.in_70.h"
+#include "bench_T1024.in_71.h"
+#include "bench_T1024.in_72.h"
+#include "bench_T1024.in_73.h"
+#include "bench_T1024.in_74.h"
+#include "bench_T1024.in_75.h"
+#include "bench_T1024.in_76.h"
+#include "bench_T1024.in_77.h"
+#include "bench_T1024.in_78.h"
+#include "bench_T1024.in_79.h"
+#include "bench_T1024.in_80.h"
+#include "bench_T1024.in_81.h"
+#include "bench_T1024.in_82.h"
+#include "bench_T1024.in_83.h"
+#include "bench_T1024.in_84.h"
+#include "bench_T1024.in_85.h"
+#include "bench_T1024.in_86.h"
+#include "bench_T1024.in_87.h"
+#include "bench_T1024.in_88.h"
+#include "bench_T1024.in_89.h"
+#include "bench_T1024.in_90.h"
+#include "bench_T1024.in_91.h"
+#include "bench_T1024.in_92.h"
+#include "bench_T1024.in_93.h"
+#include "bench_T1024.in_94.h"
+#include "bench_T1024.in_95.h"
+#include "bench_T1024.in_96.h"
+#include "bench_T1024.in_97.h"
+#include "bench_T1024.in_98.h"
+#include "bench_T1024.in_99.h"
+#include "bench_T1024.in_100.h"
+#include "bench_T1024.in_101.h"
+#include "bench_T1024.in_102.h"
+#include "bench_T1024.in_103.h"
+#include "bench_T1024.in_104.h"
+#include "bench_T1024.in_105.h"
+#include "bench_T1024.in_106.h"
+#include "bench_T1024.in_107.h"
+#include "bench_T1024.in_108.h"
+#include "bench_T1024.in_109.h"
+#include "bench_T1024.in_110.h"
+#include "bench_T1024.in_111.h"
+#include "bench_T1024.in_112.h"
+#include "bench_T1024.in_113.h"
+#include "bench_T1024.in_114.h"
+#include "bench_T1024.in_115.h"
+#include "bench_T1024.in_116.h"
+#include "bench_T1024.in_117.h"
+#include "bench_T1024.in_118.h"
+#include "bench_T1024.in_119.h"
+#include "bench_T1024.in_120.h"
+#include "bench_T1024.in_121.h"
+#include "bench_T1024.in_122.h"
+#include "bench_T1024.in_123.h"
+#include "bench_T1024.in_124.h"
+#include "bench_T1024.in_125.h"
+#include "bench_T1024.in_126.h"
+#include "bench_T1024.in_127.h"
+#include "bench_T1024.in_128.h"
+#include "bench_T1024.in_129.h"
+#include "bench_T1024.in_130.h"
+#include "bench_T1024.in_131.h"
+#include "bench_T1024.in_132.h"
+#include "bench_T1024.in_133.h"
+#include "bench_T1024.in_134.h"
+#include "bench_T1024.in_135.h"
+#include "bench_T1024.in_136.h"
+#include "bench_T1024.in_137.h"
+#include "bench_T1024.in_138.h"
+#include "bench_T1024.in_139.h"
+#include "bench_T1024.in_140.h"
+#include "bench_T1024.in_141.h"
+#include "bench_T1024.in_142.h"
+#include "bench_T1024.in_143.h"
+#include "bench_T1024.in_144.h"
+#include "bench_T1024.in_145.h"
+#include "bench_T1024.in_146.h"
+#include "bench_T1024.in_147.h"
+#include "bench_T1024.in_148.h"
+#include "bench_T1024.in_149.h"
+#include "bench_T1024.in_150.h"
+#include "bench_T1024.in_151.h"
+#include "bench_T1024.in_152.h"
+#include "bench_T1024.in_153.h"
+#include "bench_T1024.in_154.h"
+#include "bench_T1024.in_155.h"
+#include "bench_T1024.in_156.h"
+#include "bench_T1024.in_157.h"
+#include "bench_T1024.in_158.h"
+#include "bench_T1024.in_159.h"
+#include "bench_T1024.in_160.h"
+#include "bench_T1024.in_161.h"
+#include "bench_T1024.in_162.h"
+#include "bench_T1024.in_163.h"
+#include "bench_T1024.in_164.h"
+#include "bench_T1024.in_165.h"
+#include "bench_T1024.in_166.h"
+#include "bench_T1024.in_167.h"
+#include "bench_T1024.in_168.h"
+#include "bench_T1024.in_169.h"
+#include "bench_T1024.in_170.h"
+#include "bench_T1024.in_171.h"
+#include "bench_T1024.in_172.h"
+#include "bench_T1024.in_173.h"
+#include "bench_T1024.in_174.h"
+#include "bench_T1024.in_175.h"
+#include "bench_T1024.in_176.h"
+#include "bench_T1024.in_177.h"
+#include "bench_T1024.in_178.h"
+#include "bench_T1024.in_179.h"
+#include "bench_T1024.in_180.h"
+#include "bench_T1024.in_181.h"
+#include "bench_T1024.in_182.h"
+#include "bench_T1024.in_183.h"
+#include "bench_T1024.in_184.h"
+#include "bench_T1024.in_185.h"
+#include "bench_T1024.in_186.h"
+#include "bench_T1024.in_187.h"
+#include "bench_T1024.in_188.h"
+#include "bench_T1024.in_189.h"
+#include "bench_T1024.in_190.h"
+#include "bench_T1024.in_191.h"
+#include "bench_T1024.in_192.h"
+#include "bench_T1024.in_193.h"
+#include "bench_T1024.in_194.h"
+#include "bench_T1024.in_195.h"
+#include "bench_T1024.in_196.h"
+#include "bench_T1024.in_197.h"
+#include "bench_T1024.in_198.h"
+#include "bench_T1024.in_199.h"
+#include "bench_T1024.in_200.h"
+#include "bench_T1024.in_201.h"
+#include "bench_T1024.in_202.h"
+#include "bench_T1024.in_203.h"
+#include "bench_T1024.in_204.h"
+#include "bench_T1024.in_205.h"
+#include "bench_T1024.in_206.h"
+#include "bench_T1024.in_207.h"
+#include "bench_T1024.in_208.h"
+#include "bench_T1024.in_209.h"
+#include "bench_T1024.in_210.h"
+#include "bench_T1024.in_211.h"
+#include "bench_T1024.in_212.h"
+#include "bench_T1024.in_213.h"
+#include "bench_T1024.in_214.h"
+#include "bench_T1024.in_215.h"
+#include "bench_T1024.in_216.h"
+#include "bench_T1024.in_217.h"
+#include "bench_T1024.in_218.h"
+#include "bench_T1024.in_219.h"
+#include "bench_T1024.in_220.h"
+#include "bench_T1024.in_221.h"
+#include "bench_T1024.in_222.h"
+#include "bench_T1024.in_223.h"
+#include "bench_T1024.in_224.h"
+#include "bench_T1024.in_225.h"
+#include "bench_T1024.in_226.h"
+#include "bench_T1024.in_227.h"
+#include "bench_T1024.in_228.h"
+#include "bench_T1024.in_229.h"
+#include "bench_T1024.in_230.h"
+#include "bench_T1024.in_231.h"
+#include "bench_T1024.in_232.h"
+#include "bench_T1024.in_233.h"
+#include "bench_T1024.in_234.h"
+#include "bench_T1024.in_235.h"
+#include "bench_T1024.in_236.h"
+#include "bench_T1024.in_237.h"
+#include "bench_T1024.in_238.h"
+#include "bench_T1024.in_239.h"
+#include "bench_T1024.in_240.h"
+#include "bench_T1024.in_241.h"
+#include "bench_T1024.in_242.h"
+#include "bench_T1024.in_243.h"
+#include "bench_T1024.in_244.h"
+#include "bench_T1024.in_245.h"
+#include "bench_T1024.in_246.h"
+#include "bench_T1024.in_247.h"
+#include "bench_T1024.in_248.h"
+#include "bench_T1024.in_249.h"
+#include "bench_T1024.in_250.h"
+#include "bench_T1024.in_251.h"
+#include "bench_T1024.in_252.h"
+#include "bench_T1024.in_253.h"
+#include "bench_T1024.in_254.h"
+#include "bench_T1024.in_255.h"
+#include "bench_T1024.in_256.h"
+#include "bench_T1024.in_257.h"
+#include "bench_T1024.in_258.h"
+#include "bench_T1024.in_259.h"
+#include "bench_T1024.in_260.h"
+#include "bench_T1024.in_261.h"
+#include "bench_T1024.in_262.h"
+#include "bench_T1024.in_263.h"
+#include "bench_T1024.in_264.h"
+#include "bench_T1024.in_265.h"
+#include "bench_T1024.in_266.h"
+#include "bench_T1024.in_267.h"
+#include "bench_T1024.in_268.h"
+#include "bench_T1024.in_269.h"
+#include "bench_T1024.in_270.h"
+#include "bench_T1024.in_271.h"
+#include "bench_T1024.in_272.h"
+#include "bench_T1024.in_273.h"
+#include "bench_T1024.in_274.h"
+#include "bench_T1024.in_275.h"
+#include "bench_T1024.in_276.h"
+#include "bench_T1024.in_277.h"
+#include "bench_T1024.in_278.h"
+#include "bench_T1024.in_279.h"
+#include "bench_T1024.in_280.h"
+#include "bench_T1024.in_281.h"
+#include "bench_T1024.in_282.h"
+#include "bench_T1024.in_283.h"
+#include "bench_T1024.in_284.h"
+#include "bench_T1024.in_285.h"
+#include "bench_T1024.in_286.h"
+#include "bench_T1024.in_287.h"
+#include "bench_T1024.in_288.h"
+#include "bench_T1024.in_289.h"
+#include "bench_T1024.in_290.h"
+#include "bench_T1024.in_291.h"
+#include "bench_T1024.in_292.h"
+#include "bench_T1024.in_293.h"
+#include "bench_T1024.in_294.h"
+#include "bench_T1024.in_295.h"
+#include "bench_T1024.in_296.h"
+#include "bench_T1024.in_297.h"
+#include "bench_T1024.in_298.h"
+#include "bench_T1024.in_299.h"
+#include "bench_T1024.in_300.h"
+#include "bench_T1024.in_301.h"
+#include "bench_T1024.in_302.h"
+#include "bench_T1024.in_303.h"
+#include "bench_T1024.in_304.h"
+#include "bench_T1024.in_305.h"
+#include "bench_T1024.in_306.h"
+#include "bench_T1024.in_307.h"
+#include "bench_T1024.in_308.h"
+#include "bench_T1024.in_309.h"
+#include "bench_T1024.in_310.h"
+#include "bench_T1024.in_311.h"
+#include "bench_T1024.in_312.h"
+#include "bench_T1024.in_313.h"
+#include "bench_T1024.in_314.h"
+#include "bench_T1024.in_315.h"
+#include "bench_T1024.in_316.h"
+#include "bench_T1024.in_317.h"
+#include "bench_T1024.in_318.h"
+#include "bench_T1024.in_319.h"
+#include "bench_T1024.in_320.h"
+#include "bench_T1024.in_321.h"
+#include "bench_T1024.in_322.h"
+#include "bench_T1024.in_323.h"
+#include "bench_T1024.in_324.h"
+#include "bench_T1024.in_325.h"
+#include "bench_T1024.in_326.h"
+#include "bench_T1024.in_327.h"
+#include "bench_T1024.in_328.h"
+#include "bench_T1024.in_329.h"
+#include "bench_T1024.in_330.h"
+#include "bench_T1024.in_331.h"
+#include "bench_T1024.in_332.h"
+#include "bench_T1024.in_333.h"
+#include "bench_T1024.in_334.h"
+#include "bench_T1024.in_335.h"
+#include "bench_T1024.in_336.h"
+#include "bench_T1024.in_337.h"
+#include "bench_T1024.in_338.h"
+#include "bench_T1024.in_339.h"
+#include "bench_T1024.in_340.h"
+#include "bench_T1024.in_341.h"
+#include "bench_T1024.in_342.h"
+#include "bench_T1024.in_343.h"
+#include "bench_T1024.in_344.h"
+#include "bench_T1024.in_345.h"
+#include "bench_T1024.in_346.h"
+#include "bench_T1024.in_347.h"
+#include "bench_T1024.in_348.h"
+#include "bench_T1024.in_349.h"
+#include "bench_T1024.in_350.h"
+#include "bench_T1024.in_351.h"
+#include "bench_T1024.in_352.h"
+#include "bench_T1024.in_353.h"
+#include "bench_T1024.in_354.h"
+#include "bench_T1024.in_355.h"
+#include "bench_T1024.in_356.h"
+#include "bench_T1024.in_357.h"
+#include "bench_T1024.in_358.h"
+#include "bench_T1024.in_359.h"
+#include "bench_T1024.in_360.h"
+#include "bench_T1024.in_361.h"
+#include "bench_T1024.in_362.h"
+#include "bench_T1024.in_363.h"
+#include "bench_T1024.in_364.h"
+#include "bench_T1024.in_365.h"
+#include "bench_T1024.in_366.h"
+#include "bench_T1024.in_367.h"
+#include "bench_T1024.in_368.h"
+#include "bench_T1024.in_369.h"
+#include "bench_T1024.in_370.h"
+#include "bench_T1024.in_371.h"
+#include "bench_T1024.in_372.h"
+#include "bench_T1024.in_373.h"
+#include "bench_T1024.in_374.h"
+#include "bench_T1024.in_375.h"
+#include "bench_T1024.in_376.h"
+#include "bench_T1024.in_377.h"
+#include "bench_T1024.in_378.h"
+#include "bench_T1024.in_379.h"
+#include "bench_T1024.in_380.h"
+#include "bench_T1024.in_381.h"
+#include "bench_T1024.in_382.h"
+#include "bench_T1024.in_383.h"
+#include "bench_T1024.in_384.h"
+#include "bench_T1024.in_385.h"
+#include "bench_T1024.in_386.h"
+#include "bench_T1024.in_387.h"
+#include "bench_T1024.in_388.h"
+#include "bench_T1024.in_389.h"
+#include "bench_T1024.in_390.h"
+#include "bench_T1024.in_391.h"
+#include "bench_T1024.in_392.h"
+#include "bench_T1024.in_393.h"
+#include "bench_T1024.in_394.h"
+#include "bench_T1024.in_395.h"
+#include "bench_T1024.in_396.h"
+#include "bench_T1024.in_397.h"
+#include "bench_T1024.in_398.h"
+#include "bench_T1024.in_399.h"
+#include "bench_T1024.in_400.h"
+#include "bench_T1024.in_401.h"
+#include "bench_T1024.in_402.h"
+#include "bench_T1024.in_403.h"
+#include "bench_T1024.in_404.h"
+#include "bench_T1024.in_405.h"
+#include "bench_T1024.in_406.h"
+#include "bench_T1024.in_407.h"
+#include "bench_T1024.in_408.h"
+#include "bench_T1024.in_409.h"
+#include "bench_T1024.in_410.h"
+#include "bench_T1024.in_411.h"
+#include "bench_T1024.in_412.h"
+#include "bench_T1024.in_413.h"
+#include "bench_T1024.in_414.h"
+#include "bench_T1024.in_415.h"
+#include "bench_T1024.in_416.h"
+#include "bench_T1024.in_417.h"
+#include "bench_T1024.in_418.h"
+#include "bench_T1024.in_419.h"
+#include "bench_T1024.in_420.h"
+#include "bench_T1024.in_421.h"
+#include "bench_T1024.in_422.h"
+#include "bench_T1024.in_423.h"
+#include "bench_T1024.in_424.h"
+#include "bench_T1024.in_425.h"
+#include "bench_T1024.in_426.h"
+#include "bench_T1024.in_427.h"
+#include "bench_T1024.in_428.h"
+#include "bench_T1024.in_429.h"
+#include "bench_T1024.in_430.h"
+#include "bench_T1024.in_431.h"
+#include "bench_T1024.in_432.h"
+#include "bench_T1024.in_433.h"
+#include "bench_T1024.in_434.h"
+#include "bench_T1024.in_435.h"
+#include "bench_T1024.in_436.h"
+#include "bench_T1024.in_437.h"
+#include "bench_T1024.in_438.h"
+#include "bench_T1024.in_439.h"
+#include "bench_T1024.in_440.h"
+#include "bench_T1024.in_441.h"
+#include "bench_T1024.in_442.h"
+#include "bench_T1024.in_443.h"
+#include "bench_T1024.in_444.h"
+#include "bench_T1024.in_445.h"
+#include "bench_T1024.in_446.h"
+#include "bench_T1024.in_447.h"
+#include "bench_T1024.in_448.h"
+#include "bench_T1024.in_449.h"
+#include "bench_T1024.in_450.h"
+#include "bench_T1024.in_451.h"
+#include "bench_T1024.in_452.h"
+#include "bench_T1024.in_453.h"
+#include "bench_T1024.in_454.h"
+#include "bench_T1024.in_455.h"
+#include "bench_T1024.in_456.h"
+#include "bench_T1024.in_457.h"
+#include "bench_T1024.in_458.h"
+#include "bench_T1024.in_459.h"
+#include "bench_T1024.in_460.h"
+#include "bench_T1024.in_461.h"
+#include "bench_T1024.in_462.h"
+#include "bench_T1024.in_463.h"
+#include "bench_T1024.in_464.h"
+#include "bench_T1024.in_465.h"
+#include "bench_T1024.in_466.h"
+#include "bench_T1024.in_467.h"
+#include "bench_T1024.in_468.h"
+#include "bench_T1024.in_469.h"
+#include "bench_T1024.in_470.h"
+#include "bench_T1024.in_471.h"
+#include "bench_T1024.in_472.h"
+#include "bench_T1024.in_473.h"
+#include "bench_T1024.in_474.h"
+#include "bench_T1024.in_475.h"
+#include "bench_T1024.in_476.h"
+#include "bench_T1024.in_477.h"
+#include "bench_T1024.in_478.h"
+#include "bench_T1024.in_479.h"
+#include "bench_T1024.in_480.h"
+#include "bench_T1024.in_481.h"
+#include "bench_T1024.in_482.h"
+#include "bench_T1024.in_483.h"
+#include "bench_T1024.in_484.h"
+#include "bench_T1024.in_485.h"
+#include "bench_T1024.in_486.h"
+#include "bench_T1024.in_487.h"
+#include "bench_T1024.in_488.h"
+#include "bench_T1024.in_489.h"
+#include "bench_T1024.in_490.h"
+#include "bench_T1024.in_491.h"
+#include "bench_T1024.in_492.h"
+#include "bench_T1024.in_493.h"
+#include "bench_T1024.in_494.h"
+#include "bench_T1024.in_495.h"
+#include "bench_T1024.in_496.h"
+#include "bench_T1024.in_497.h"
+#include "bench_T1024.in_498.h"
+#include "bench_T1024.in_499.h"
+#include "bench_T1024.in_500.h"
+#include "bench_T1024.in_501.h"
+#include "bench_T1024.in_502.h"
+#include "bench_T1024.in_503.h"
+#include "bench_T1024.in_504.h"
+#include "bench_T1024.in_505.h"
+#include "bench_T1024.in_506.h"
+#include "bench_T1024.in_507.h"
+#include "bench_T1024.in_508.h"
+#include "bench_T1024.in_509.h"
+#include "bench_T1024.in_510.h"
+#include "bench_T1024.in_511.h"
+#include "bench_T1024.in_512.h"
+#include "bench_T1024.in_513.h"
+#include "bench_T1024.in_514.h"
+#include "bench_T1024.in_515.h"
+#include "bench_T1024.in_516.h"
+#include "bench_T1024.in_517.h"
+#include "bench_T1024.in_518.h"
+#include "bench_T1024.in_519.h"
+#include "bench_T1024.in_520.h"
+#include "bench_T1024.in_521.h"
+#include "bench_T1024.in_522.h"
+#include "bench_T1024.in_523.h"
+#include "bench_T1024.in_524.h"
+#include "bench_T1024.in_525.h"
+#include "bench_T1024.in_526.h"
+#include "bench_T1024.in_527.h"
+#include "bench_T1024.in_528.h"
+#include "bench_T1024.in_529.h"
+#include "bench_T1024.in_530.h"
+#include "bench_T1024.in_531.h"
+#include "bench_T1024.in_532.h"
+#include "bench_T1024.in_533.h"
+#include "bench_T1024.in_534.h"
+#include "bench_T1024.in_535.h"
+#include "bench_T1024.in_536.h"
+#include "bench_T1024.in_537.h"
+#include "bench_T1024.in_538.h"
+#include "bench_T1024.in_539.h"
+#include "bench_T1024.in_540.h"
+#include "bench_T1024.in_541.h"
+#include "bench_T1024.in_542.h"
+#include "bench_T1024.in_543.h"
+#include "bench_T1024.in_544.h"
+#include "bench_T1024.in_545.h"
+#include "bench_T1024.in_546.h"
+#include "bench_T1024.in_547.h"
+#include "bench_T1024.in_548.h"
+#include "bench_T1024.in_549.h"
+#include "bench_T1024.in_550.h"
+#include "bench_T1024.in_551.h"
+#include "bench_T1024.in_552.h"
+#include "bench_T1024.in_553.h"
+#include "bench_T1024.in_554.h"
+#include "bench_T1024.in_555.h"
+#include "bench_T1024.in_556.h"
+#include "bench_T1024.in_557.h"
+#include "bench_T1024.in_558.h"
+#include "bench_T1024.in_559.h"
+#include "bench_T1024.in_560.h"
+#include "bench_T1024.in_561.h"
+#include "bench_T1024.in_562.h"
+#include "bench_T1024.in_563.h"
+#include "bench_T1024.in_564.h"
+#include "bench_T1024.in_565.h"
+#include "bench_T1024.in_566.h"
+#include "bench_T1024.in_567.h"
+#include "bench_T1024.in_568.h"
+#include "bench_T1024.in_569.h"
+#include "bench_T1024.in_570.h"
+#include "bench_T1024.in_571.h"
+#include "bench_T1024.in_572.h"
+#include "bench_T1024.in_573.h"
+#include "bench_T1024.in_574.h"
+#include "bench_T1024.in_575.h"
+#include "bench_T1024.in_576.h"
+#include "bench_T1024.in_577.h"
+#include "bench_T1024.in_578.h"
+#include "bench_T1024.in_579.h"
+#include "bench_T1024.in_580.h"
+#include "bench_T1024.in_581.h"
+#include "bench_T1024.in_582.h"
+#include "bench_T1024.in_583.h"
+#include "bench_T1024.in_584.h"
+#include "bench_T1024.in_585.h"
+#include "bench_T1024.in_586.h"
+#include "bench_T1024.in_587.h"
+#include "bench_T1024.in_588.h"
+#include "bench_T1024.in_589.h"
+#include "bench_T1024.in_590.h"
+#include "bench_T1024.in_591.h"
+#include "bench_T1024.in_592.h"
+#include "bench_T1024.in_593.h"
+#include "bench_T1024.in_594.h"
+#include "bench_T1024.in_595.h"
+#include "bench_T1024.in_596.h"
+#include "bench_T1024.in_597.h"
+#include "bench_T1024.in_598.h"
+#include "bench_T1024.in_599.h"
+#include "bench_T1024.in_600.h"
+#include "bench_T1024.in_601.h"
+#include "bench_T1024.in_602.h"
+#include "bench_T1024.in_603.h"
+#include "bench_T1024.in_604.h"
+#include "bench_T1024.in_605.h"
+#include "bench_T1024.in_606.h"
+#include "bench_T1024.in_607.h"
+#include "bench_T1024.in_608.h"
+#include "bench_T1024.in_609.h"
+#include "bench_T1024.in_610.h"
+#include "bench_T1024.in_611.h"
+#include "bench_T1024.in_612.h"
+#include "bench_T1024.in_613.h"
+#include "bench_T1024.in_614.h"
+#include "bench_T1024.in_615.h"
+#include "bench_T1024.in_616.h"
+#include "bench_T1024.in_617.h"
+#include "bench_T1024.in_618.h"
+#include "bench_T1024.in_619.h"
+#include "bench_T1024.in_620.h"
+#include "bench_T1024.in_621.h"
+#include "bench_T1024.in_622.h"
+#include "bench_T1024.in_623.h"
+#include "bench_T1024.in_624.h"
+#include "bench_T1024.in_625.h"
+#include "bench_T1024.in_626.h"
+#include "bench_T1024.in_627.h"
+#include "bench_T1024.in_628.h"
+#include "bench_T1024.in_629.h"
+#include "bench_T1024.in_630.h"
+#include "bench_T1024.in_631.h"
+#include "bench_T1024.in_632.h"
+#include "bench_T1024.in_633.h"
+#include "bench_T1024.in_634.h"
+#include "bench_T1024.in_635.h"
+#include "bench_T1024.in_636.h"
+#include "bench_T1024.in_637.h"
+#include "bench_T1024.in_638.h"
+#include "bench_T1024.in_639.h"
+#include "bench_T1024.in_640.h"
+#include "bench_T1024.in_641.h"
+#include "bench_T1024.in_642.h"
+#include "bench_T1024.in_643.h"
+#include "bench_T1024.in_644.h"
+#include "bench_T1024.in_645.h"
+#include "bench_T1024.in_646.h"
+#include "bench_T1024.in_647.h"
+#include "bench_T1024.in_648.h"
+#include "bench_T1024.in_649.h"
+#include "bench_T1024.in_650.h"
+#include "bench_T1024.in_651.h"
+#include "bench_T1024.in_652.h"
+#include "bench_T1024.in_653.h"
+#include "bench_T1024.in_654.h"
+#include "bench_T1024.in_655.h"
+#include "bench_T1024.in_656.h"
+#include "bench_T1024.in_657.h"
+#include "bench_T1024.in_658.h"
+#include "bench_T1024.in_659.h"
+#include "bench_T1024.in_660.h"
+#include "bench_T1024.in_661.h"
+#include "bench_T1024.in_662.h"
+#include "bench_T1024.in_663.h"
+#include "bench_T1024.in_664.h"
+#include "bench_T1024.in_665.h"
+#include "bench_T1024.in_666.h"
+#include "bench_T1024.in_667.h"
+#include "bench_T1024.in_668.h"
+#include "bench_T1024.in_669.h"
+#include "bench_T1024.in_670.h"
+#include "bench_T1024.in_671.h"
+#include "bench_T1024.in_672.h"
+#include "bench_T1024.in_673.h"
+#include "bench_T1024.in_674.h"
+#include "bench_T1024.in_675.h"
+#include "bench_T1024.in_676.h"
+#include "bench_T1024.in_677.h"
+#include "bench_T1024.in_678.h"
+#include "bench_T1024.in_679.h"
+#include "bench_T1024.in_680.h"
+#include "bench_T1024.in_681.h"
+#include "bench_T1024.in_682.h"
+#include "bench_T1024.in_683.h"
+#include "bench_T1024.in_684.h"
+#include "bench_T1024.in_685.h"
+#include "bench_T1024.in_686.h"
+#include "bench_T1024.in_687.h"
+#include "bench_T1024.in_688.h"
+#include "bench_T1024.in_689.h"
+#include "bench_T1024.in_690.h"
+#include "bench_T1024.in_691.h"
+#include "bench_T1024.in_692.h"
+#include "bench_T1024.in_693.h"
+#include "bench_T1024.in_694.h"
+#include "bench_T1024.in_695.h"
+#include "bench_T1024.in_696.h"
+#include "bench_T1024.in_697.h"
+#include "bench_T1024.in_698.h"
+#include "bench_T1024.in_699.h"
+#include "bench_T1024.in_700.h"
+#include "bench_T1024.in_701.h"
+#include "bench_T1024.in_702.h"
+#include "bench_T1024.in_703.h"
+#include "bench_T1024.in_704.h"
+#include "bench_T1024.in_705.h"
+#include "bench_T1024.in_706.h"
+#include "bench_T1024.in_707.h"
+#include "bench_T1024.in_708.h"
+#include "bench_T1024.in_709.h"
+#include "bench_T1024.in_710.h"
+#include "bench_T1024.in_711.h"
+#include "bench_T1024.in_712.h"
+#include "bench_T1024.in_713.h"
+#include "bench_T1024.in_714.h"
+#include "bench_T1024.in_715.h"
+#include "bench_T1024.in_716.h"
+#include "bench_T1024.in_717.h"
+#include "bench_T1024.in_718.h"
+#include "bench_T1024.in_719.h"
+#include "bench_T1024.in_720.h"
+#include "bench_T1024.in_721.h"
+#include "bench_T1024.in_722.h"
+#include "bench_T1024.in_723.h"
+#include "bench_T1024.in_724.h"
+#include "bench_T1024.in_725.h"
+#include "bench_T1024.in_726.h"
+#include "bench_T1024.in_727.h"
+#include "bench_T1024.in_728.h"
+#include "bench_T1024.in_729.h"
+#include "bench_T1024.in_730.h"
+#include "bench_T1024.in_731.h"
+#include "bench_T1024.in_732.h"
+#include "bench_T1024.in_733.h"
+#include "bench_T1024.in_734.h"
+#include "bench_T1024.in_735.h"
+#include "bench_T1024.in_736.h"
+#include "bench_T1024.in_737.h"
+#include "bench_T1024.in_738.h"
+#include "bench_T1024.in_739.h"
+#include "bench_T1024.in_740.h"
+#include "bench_T1024.in_741.h"
+#include "bench_T1024.in_742.h"
+#include "bench_T1024.in_743.h"
+#include "bench_T1024.in_744.h"
+#include "bench_T1024.in_745.h"
+#include "bench_T1024.in_746.h"
+#include "bench_T1024.in_747.h"
+#include "bench_T1024.in_748.h"
+#include "bench_T1024.in_749.h"
+#include "bench_T1024.in_750.h"
+#include "bench_T1024.in_751.h"
+#include "bench_T1024.in_752.h"
+#include "bench_T1024.in_753.h"
+#include "bench_T1024.in_754.h"
+#include "bench_T1024.in_755.h"
+#include "bench_T1024.in_756.h"
+#include "bench_T1024.in_757.h"
+#include "bench_T1024.in_758.h"
+#include "bench_T1024.in_759.h"
+#include "bench_T1024.in_760.h"
+#include "bench_T1024.in_761.h"
+#include "bench_T1024.in_762.h"
+#include "bench_T1024.in_763.h"
+#include "bench_T1024.in_764.h"
+#include "bench_T1024.in_765.h"
+#include "bench_T1024.in_766.h"
+#include "bench_T1024.in_767.h"
+#include "bench_T1024.in_768.h"
+#include "bench_T1024.in_769.h"
+#include "bench_T1024.in_770.h"
+#include "bench_T1024.in_771.h"
+#include "bench_T1024.in_772.h"
+#include "bench_T1024.in_773.h"
+#include "bench_T1024.in_774.h"
+#include "bench_T1024.in_775.h"
+#include "bench_T1024.in_776.h"
+#include "bench_T1024.in_777.h"
+#include "bench_T1024.in_778.h"
+#include "bench_T1024.in_779.h"
+#include "bench_T1024.in_780.h"
+#include "bench_T1024.in_781.h"
+#include "bench_T1024.in_782.h"
+#include "bench_T1024.in_783.h"
+#include "bench_T1024.in_784.h"
+#include "bench_T1024.in_785.h"
+#include "bench_T1024.in_786.h"
+#include "bench_T1024.in_787.h"
+#include "bench_T1024.in_788.h"
+#include "bench_T1024.in_789.h"
+#include "bench_T1024.in_790.h"
+#include "bench_T1024.in_791.h"
+#include "bench_T1024.in_792.h"
+#include "bench_T1024.in_793.h"
+#include "bench_T1024.in_794.h"
+#include "bench_T1024.in_795.h"
+#include "bench_T1024.in_796.h"
+#include "bench_T1024.in_797.h"
+#include "bench_T1024.in_798.h"
+#include "bench_T1024.in_799.h"
+#include "bench_T1024.in_800.h"
+#include "bench_T1024.in_801.h"
+#include "bench_T1024.in_802.h"
+#include "bench_T1024.in_803.h"
+#include "bench_T1024.in_804.h"
+#include "bench_T1024.in_805.h"
+#include "bench_T1024.in_806.h"
+#include "bench_T1024.in_807.h"
+#include "bench_T1024.in_808.h"
+#include "bench_T1024.in_809.h"
+#include "bench_T1024.in_810.h"
+#include "bench_T1024.in_811.h"
+#include "bench_T1024.in_812.h"
+#include "bench_T1024.in_813.h"
+#include "bench_T1024.in_814.h"
+#include "bench_T1024.in_815.h"
+#include "bench_T1024.in_816.h"
+#include "bench_T1024.in_817.h"
+#include "bench_T1024.in_818.h"
+#include "bench_T1024.in_819.h"
+#include "bench_T1024.in_820.h"
+#include "bench_T1024.in_821.h"
+#include "bench_T1024.in_822.h"
+#include "bench_T1024.in_823.h"
+#include "bench_T1024.in_824.h"
+#include "bench_T1024.in_825.h"
+#include "bench_T1024.in_826.h"
+#include "bench_T1024.in_827.h"
+#include "bench_T1024.in_828.h"
+#include "bench_T1024.in_829.h"
+#include "bench_T1024.in_830.h"
+#include "bench_T1024.in_831.h"
+#include "bench_T1024.in_832.h"
+#include "bench_T1024.in_833.h"
+#include "bench_T1024.in_834.h"
+#include "bench_T1024.in_835.h"
+#include "bench_T1024.in_836.h"
+#include "bench_T1024.in_837.h"
+#include "bench_T1024.in_838.h"
+#include "bench_T1024.in_839.h"
+#include "bench_T1024.in_840.h"
+#include "bench_T1024.in_841.h"
+#include "bench_T1024.in_842.h"
+#include "bench_T1024.in_843.h"
+#include "bench_T1024.in_844.h"
+#include "bench_T1024.in_845.h"
+#include "bench_T1024.in_846.h"
+#include "bench_T1024.in_847.h"
+#include "bench_T1024.in_848.h"
+#include "bench_T1024.in_849.h"
+#include "bench_T1024.in_850.h"
+#include "bench_T1024.in_851.h"
+#include "bench_T1024.in_852.h"
+#include "bench_T1024.in_853.h"
+#include "bench_T1024.in_854.h"
+#include "bench_T1024.in_855.h"
+#include "bench_T1024.in_856.h"
+#include "bench_T1024.in_857.h"
+#include "bench_T1024.in_858.h"
+#include "bench_T1024.in_859.h"
+#include "bench_T1024.in_860.h"
+#include "bench_T1024.in_861.h"
+#include "bench_T1024.in_862.h"
+#include "bench_T1024.in_863.h"
+#include "bench_T1024.in_864.h"
+#include "bench_T1024.in_865.h"
+#include "bench_T1024.in_866.h"
+#include "bench_T1024.in_867.h"
+#include "bench_T1024.in_868.h"
+#include "bench_T1024.in_869.h"
+#include "bench_T1024.in_870.h"
+#include "bench_T1024.in_871.h"
+#include "bench_T1024.in_872.h"
+#include "bench_T1024.in_873.h"
+#include "bench_T1024.in_874.h"
+#include "bench_T1024.in_875.h"
+#include "bench_T1024.in_876.h"
+#include "bench_T1024.in_877.h"
+#include "bench_T1024.in_878.h"
+#include "bench_T1024.in_879.h"
+#include "bench_T1024.in_880.h"
+#include "bench_T1024.in_881.h"
+#include "bench_T1024.in_882.h"
+#include "bench_T1024.in_883.h"
+#include "bench_T1024.in_884.h"
+#include "bench_T1024.in_885.h"
+#include "bench_T1024.in_886.h"
+#include "bench_T1024.in_887.h"
+#include "bench_T1024.in_888.h"
+#include "bench_T1024.in_889.h"
+#include "bench_T1024.in_890.h"
+#include "bench_T1024.in_891.h"
+#include "bench_T1024.in_892.h"
+#include "bench_T1024.in_893.h"
+#include "bench_T1024.in_894.h"
+#include "bench_T1024.in_895.h"
+#include "bench_T1024.in_896.h"
+#include "bench_T1024.in_897.h"
+#include "bench_T1024.in_898.h"
+#include "bench_T1024.in_899.h"
+#include "bench_T1024.in_900.h"
+#include "bench_T1024.in_901.h"
+#include "bench_T1024.in_902.h"
+#include "bench_T1024.in_903.h"
+#include "bench_T1024.in_904.h"
+#include "bench_T1024.in_905.h"
+#include "bench_T1024.in_906.h"
+#include "bench_T1024.in_907.h"
+#include "bench_T1024.in_908.h"
+#include "bench_T1024.in_909.h"
+#include "bench_T1024.in_910.h"
+#include "bench_T1024.in_911.h"
+#include "bench_T1024.in_912.h"
+#include "bench_T1024.in_913.h"
+#include "bench_T1024.in_914.h"
+#include "bench_T1024.in_915.h"
+#include "bench_T1024.in_916.h"
+#include "bench_T1024.in_917.h"
+#include "bench_T1024.in_918.h"
+#include "bench_T1024.in_919.h"
+#include "bench_T1024.in_920.h"
+#include "bench_T1024.in_921.h"
+#include "bench_T1024.in_922.h"
+#include "bench_T1024.in_923.h"
+#include "bench_T1024.in_924.h"
+#include "bench_T1024.in_925.h"
+#include "bench_T1024.in_926.h"
+#include "bench_T1024.in_927.h"
+#include "bench_T1024.in_928.h"
+#include "bench_T1024.in_929.h"
+#include "bench_T1024.in_930.h"
+#include "bench_T1024.in_931.h"
+#include "bench_T1024.in_932.h"
+#include "bench_T1024.in_933.h"
+#include "bench_T1024.in_934.h"
+#include "bench_T1024.in_935.h"
+#include "bench_T1024.in_936.h"
+#include "bench_T1024.in_937.h"
+#include "bench_T1024.in_938.h"
+#include "bench_T1024.in_939.h"
+#include "bench_T1024.in_940.h"
+#include "bench_T1024.in_941.h"
+#include "bench_T1024.in_942.h"
+#include "bench_T1024.in_943.h"
+#include "bench_T1024.in_944.h"
+#include "bench_T1024.in_945.h"
+#include "bench_T1024.in_946.h"
+#include "bench_T1024.in_947.h"
+#include "bench_T1024.in_948.h"
+#include "bench_T1024.in_949.h"
+#include "bench_T1024.in_950.h"
+#include "bench_T1024.in_951.h"
+#include "bench_T1024.in_952.h"
+#include "bench_T1024.in_953.h"
+#include "bench_T1024.in_954.h"
+#include "bench_T1024.in_955.h"
+#include "bench_T1024.in_956.h"
+#include "bench_T1024.in_957.h"
+#include "bench_T1024.in_958.h"
+#include "bench_T1024.in_959.h"
+#include "bench_T1024.in_960.h"
+#include "bench_T1024.in_961.h"
+#include "bench_T1024.in_962.h"
+#include "bench_T1024.in_963.h"
+#include "bench_T1024.in_964.h"
+#include "bench_T1024.in_965.h"
+#include "bench_T1024.in_966.h"
+#include "bench_T1024.in_967.h"
+#include "bench_T1024.in_968.h"
+#include "bench_T1024.in_969.h"
+#include "bench_T1024.in_970.h"
+#include "bench_T1024.in_971.h"
+#include "bench_T1024.in_972.h"
+#include "bench_T1024.in_973.h"
+#include "bench_T1024.in_974.h"
+#include "bench_T1024.in_975.h"
+#include "bench_T1024.in_976.h"
+#include "bench_T1024.in_977.h"
+#include "bench_T1024.in_978.h"
+#include "bench_T1024.in_979.h"
+#include "bench_T1024.in_980.h"
+#include "bench_T1024.in_981.h"
+#include "bench_T1024.in_982.h"
+#include "bench_T1024.in_983.h"
+#include "bench_T1024.in_984.h"
+#include "bench_T1024.in_985.h"
+#include "bench_T1024.in_986.h"
+#include "bench_T1024.in_987.h"
+#include "bench_T1024.in_988.h"
+#include "bench_T1024.in_989.h"
+#include "bench_T1024.in_990.h"
+#include "bench_T1024.in_991.h"
+#include "bench_T1024.in_992.h"
+#include "bench_T1024.in_993.h"
+#include "bench_T1024.in_994.h"
+#include "bench_T1024.in_995.h"
+#include "bench_T1024.in_996.h"
+#include "bench_T1024.in_997.h"
+#include "bench_T1024.in_998.h"
+#include "bench_T1024.in_999.h"
+#include "bench_T1024.in_1000.h"
+#include "bench_T1024.in_1001.h"
+#include "bench_T1024.in_1002.h"
+#include "bench_T1024.in_1003.h"
+#include "bench_T1024.in_1004.h"
+#include "bench_T1024.in_1005.h"
+#include "bench_T1024.in_1006.h"
+#include "bench_T1024.in_1007.h"
+#include "bench_T1024.in_1008.h"
+#include "bench_T1024.in_1009.h"
+#include "bench_T1024.in_1010.h"
+#include "bench_T1024.in_1011.h"
+#include "bench_T1024.in_1012.h"
+#include "bench_T1024.in_1013.h"
+#include "bench_T1024.in_1014.h"
+#include "bench_T1024.in_1015.h"
+#include "bench_T1024.in_1016.h"
+#include "bench_T1024.in_1017.h"
+#include "bench_T1024.in_1018.h"
+#include "bench_T1024.in_1019.h"
+#include "bench_T1024.in_1020.h"
+#include "bench_T1024.in_1021.h"
+#include "bench_T1024.in_1022.h"
+#include "bench_T1024.in_1023.h"
+
+
+int main()
+{
+   register int r_out_t0 asm("8");
+   register int r_out_t1 asm("9");
+   register int r_out_t2 asm("10");
+   register int r_out_t3 asm("11");
+   register int r_out_t4 asm("12");
+   register int r_out_t5 asm("13");
+   register int r_out_s0 asm("16");
+   register int r_out_s1 asm("17");
+   register int r_out_s2 asm("18");
+   register int r_out_s3 asm("19");
+   register int r_out_s4 asm("20");
+   register int r_out_s5 asm("21");
+   register int r_out_f2 asm("$f2");
+   register int r_out_f4 asm("$f4");
+   register int r_out_f6 asm("$f6");
+   register int r_out_f8 asm("$f8");
+   register int r_out_f10 asm("$f10");
+   register int r_out_f12 asm("$f12");
+
+   register int data_out_int asm("20");
+   register int data_out_float asm("21");
+
+   /* Set Loop */
+   unsigned int counter;
+
+   /* Initialize Private Memory Region */
+   int* memInt;
+   int data_out_int_base;
+   register int cell_counter asm("23");		//inner loop counter
+   register int block_counter asm("14");		//outer loop counter
+
+   memInt           = (int*)malloc(sizeof(int) * 262144);
+   data_out_int     = (int)&(memInt[0]);
+
+   shared_memInt    = (int*)malloc(sizeof(int) * 262144);
+   s_data_out_int   = (int)&(shared_memInt[0]);
+
+   s_data_out_int_base = s_data_out_int;
+   data_out_int_base = data_out_int;
+
+   //spawn threads
+   sesc_spawn(threadFunc1, NULL, 0);
+   sesc_spawn(threadFunc2, NULL, 0);
+   sesc_spawn(threadFunc3, NULL, 0);
+   sesc_spawn(threadFunc4, NULL, 0);
+   sesc_spawn(threadFunc5, NULL, 0);
+   sesc_spawn(threadFunc6, NULL, 0);
+   sesc_spawn(threadFunc7, NULL, 0);
+   sesc_spawn(threadFunc8, NULL, 0);
+   sesc_spawn(threadFunc9, NULL, 0);
+   sesc_spawn(threadFunc10, NULL, 0);
+   sesc_spawn(threadFunc11, NULL, 0);
+   sesc_spawn(threadFunc12, NULL, 0);
+   sesc_spawn(threadFunc13, NULL, 0);
+   sesc_spawn(threadFunc14, NULL, 0);
+   sesc_spawn(threadFunc15, NULL, 0);
+   sesc_spawn(threadFunc16, NULL, 0);
+   sesc_spawn(threadFunc17, NULL, 0);
+   sesc_spawn(threadFunc18, NULL, 0);
+   sesc_spawn(threadFunc19, NULL, 0);
+   sesc_spawn(threadFunc20, NULL, 0);
+   sesc_spawn(threadFunc21, NULL, 0);
+   sesc_spawn(threadFunc22, NULL, 0);
+   sesc_spawn(threadFunc23, NULL, 0);
+   sesc_spawn(threadFunc24, NULL, 0);
+   sesc_spawn(threadFunc25, NULL, 0);
+   sesc_spawn(threadFunc26, NULL, 0);
+   sesc_spawn(threadFunc27, NULL, 0);
+   sesc_spawn(threadFunc28, NULL, 0);
+   sesc_spawn(threadFunc29, NULL, 0);
+   sesc_spawn(threadFunc30, NULL, 0);
+   sesc_spawn(threadFunc31, NULL, 0);
+   sesc_spawn(threadFunc32, NULL, 0);
+   sesc_spawn(threadFunc33, NULL, 0);
+   sesc_spawn(threadFunc34, NULL, 0);
+   sesc_spawn(threadFunc35, NULL, 0);
+   sesc_spawn(threadFunc36, NULL, 0);
+   sesc_spawn(threadFunc37, NULL, 0);
+   sesc_spawn(threadFunc38, NULL, 0);
+   sesc_spawn(threadFunc39, NULL, 0);
+   sesc_spawn(threadFunc40, NULL, 0);
+   sesc_spawn(threadFunc41, NULL, 0);
+   sesc_spawn(threadFunc42, NULL, 0);
+   sesc_spawn(threadFunc43, NULL, 0);
+   sesc_spawn(threadFunc44, NULL, 0);
+   sesc_spawn(threadFunc45, NULL, 0);
+   sesc_spawn(threadFunc46, NULL, 0);
+   sesc_spawn(threadFunc47, NULL, 0);
+   sesc_spawn(threadFunc48, NULL, 0);
+   sesc_spawn(threadFunc49, NULL, 0);
+   sesc_spawn(threadFunc50, NULL, 0);
+   sesc_spawn(threadFunc51, NULL, 0);
+   sesc_spawn(threadFunc52, NULL, 0);
+   sesc_spawn(threadFunc53, NULL, 0);
+   sesc_spawn(threadFunc54, NULL, 0);
+   sesc_spawn(threadFunc55, NULL, 0);
+   sesc_spawn(threadFunc56, NULL, 0);
+   sesc_spawn(threadFunc57, NULL, 0);
+   sesc_spawn(threadFunc58, NULL, 0);
+   sesc_spawn(threadFunc59, NULL, 0);
+   sesc_spawn(threadFunc60, NULL, 0);
+   sesc_spawn(threadFunc61, NULL, 0);
+   sesc_spawn(threadFunc62, NULL, 0);
+   sesc_spawn(threadFunc63, NULL, 0);
+   sesc_spawn(threadFunc64, NULL, 0);
+   sesc_spawn(threadFunc65, NULL, 0);
+   sesc_spawn(threadFunc66, NULL, 0);
+   sesc_spawn(threadFunc67, NULL, 0);
+   sesc_spawn(threadFunc68, NULL, 0);
+   sesc_spawn(threadFunc69, NULL, 0);
+   sesc_spawn(threadFunc70, NULL, 0);
+   sesc_spawn(threadFunc71, NULL, 0);
+   sesc_spawn(threadFunc72, NULL, 0);
+   sesc_spawn(threadFunc73, NULL, 0);
+   sesc_spawn(threadFunc74, NULL, 0);
+   sesc_spawn(threadFunc75, NULL, 0);
+   sesc_spawn(threadFunc76, NULL, 0);
+   sesc_spawn(threadFunc77, NULL, 0);
+   sesc_spawn(threadFunc78, NULL, 0);
+   sesc_spawn(threadFunc79, NULL, 0);
+   sesc_spawn(threadFunc80, NULL, 0);
+   sesc_spawn(threadFunc81, NULL, 0);
+   sesc_spawn(threadFunc82, NULL, 0);
+   sesc_spawn(threadFunc83, NULL, 0);
+   sesc_spawn(threadFunc84, NULL, 0);
+   sesc_spawn(threadFunc85, NULL, 0);
+   sesc_spawn(threadFunc86, NULL, 0);
+   sesc_spawn(threadFunc87, NULL, 0);
+   sesc_spawn(threadFunc88, NULL, 0);
+   sesc_spawn(threadFunc89, NULL, 0);
+   sesc_spawn(threadFunc90, NULL, 0);
+   sesc_spawn(threadFunc91, NULL, 0);
+   sesc_spawn(threadFunc92, NULL, 0);
+   sesc_spawn(threadFunc93, NULL, 0);
+   sesc_spawn(threadFunc94, NULL, 0);
+   sesc_spawn(threadFunc95, NULL, 0);
+   sesc_spawn(threadFunc96, NULL, 0);
+   sesc_spawn(threadFunc97, NULL, 0);
+   sesc_spawn(threadFunc98, NULL, 0);
+   sesc_spawn(threadFunc99, NULL, 0);
+   sesc_spawn(threadFunc100, NULL, 0);
+   sesc_spawn(threadFunc101, NULL, 0);
+   sesc_spawn(threadFunc102, NULL, 0);
+   sesc_spawn(threadFunc103, NULL, 0);
+   sesc_spawn(threadFunc104, NULL, 0);
+   sesc_spawn(threadFunc105, NULL, 0);
+   sesc_spawn(threadFunc106, NULL, 0);
+   sesc_spawn(threadFunc107, NULL, 0);
+   sesc_spawn(threadFunc108, NULL, 0);
+   sesc_spawn(threadFunc109, NULL, 0);
+   sesc_spawn(threadFunc110, NULL, 0);
+   sesc_spawn(threadFunc111, NULL, 0);
+   sesc_spawn(threadFunc112, NULL, 0);
+   sesc_spawn(threadFunc113, NULL, 0);
+   sesc_spawn(threadFunc114, NULL, 0);
+   sesc_spawn(threadFunc115, NULL, 0);
+   sesc_spawn(threadFunc116, NULL, 0);
+   sesc_spawn(threadFunc117, NULL, 0);
+   sesc_spawn(threadFunc118, NULL, 0);
+   sesc_spawn(threadFunc119, NULL, 0);
+   sesc_spawn(threadFunc120, NULL, 0);
+   sesc_spawn(threadFunc121, NULL, 0);
+   sesc_spawn(threadFunc122, NULL, 0);
+   sesc_spawn(threadFunc123, NULL, 0);
+   sesc_spawn(threadFunc124, NULL, 0);
+   sesc_spawn(threadFunc125, NULL, 0);
+   sesc_spawn(threadFunc126, NULL, 0);
+   sesc_spawn(threadFunc127, NULL, 0);
+   sesc_spawn(threadFunc128, NULL, 0);
+   sesc_spawn(threadFunc129, NULL, 0);
+   sesc_spawn(threadFunc130, NULL, 0);
+   sesc_spawn(threadFunc131, NULL, 0);
+   sesc_spawn(threadFunc132, NULL, 0);
+   sesc_spawn(threadFunc133, NULL, 0);
+   sesc_spawn(threadFunc134, NULL, 0);
+   sesc_spawn(threadFunc135, NULL, 0);
+   sesc_spawn(threadFunc136, NULL, 0);
+   sesc_spawn(threadFunc137, NULL, 0);
+   sesc_spawn(threadFunc138, NULL, 0);
+   sesc_spawn(threadFunc139, NULL, 0);
+   sesc_spawn(threadFunc140, NULL, 0);
+   sesc_spawn(threadFunc141, NULL, 0);
+   sesc_spawn(threadFunc142, NULL, 0);
+   sesc_spawn(threadFunc143, NULL, 0);
+   sesc_spawn(threadFunc144, NULL, 0);
+   sesc_spawn(threadFunc145, NULL, 0);
+   sesc_spawn(threadFunc146, NULL, 0);
+   sesc_spawn(threadFunc147, NULL, 0);
+   sesc_spawn(threadFunc148, NULL, 0);
+   sesc_spawn(threadFunc149, NULL, 0);
+   sesc_spawn(threadFunc150, NULL, 0);
+   sesc_spawn(threadFunc151, NULL, 0);
+   sesc_spawn(threadFunc152, NULL, 0);
+   sesc_spawn(threadFunc153, NULL, 0);
+   sesc_spawn(threadFunc154, NULL, 0);
+   sesc_spawn(threadFunc155, NULL, 0);
+   sesc_spawn(threadFunc156, NULL, 0);
+   sesc_spawn(threadFunc157, NULL, 0);
+   sesc_spawn(threadFunc158, NULL, 0);
+   sesc_spawn(threadFunc159, NULL, 0);
+   sesc_spawn(threadFunc160, NULL, 0);
+   sesc_spawn(threadFunc161, NULL, 0);
+   sesc_spawn(threadFunc162, NULL, 0);
+   sesc_spawn(threadFunc163, NULL, 0);
+   sesc_spawn(threadFunc164, NULL, 0);
+   sesc_spawn(threadFunc165, NULL, 0);
+   sesc_spawn(threadFunc166, NULL, 0);
+   sesc_spawn(threadFunc167, NULL, 0);
+   sesc_spawn(threadFunc168, NULL, 0);
+   sesc_spawn(threadFunc169, NULL, 0);
+   sesc_spawn(threadFunc170, NULL, 0);
+   sesc_spawn(threadFunc171, NULL, 0);
+   sesc_spawn(threadFunc172, NULL, 0);
+   sesc_spawn(threadFunc173, NULL, 0);
+   sesc_spawn(threadFunc174, NULL, 0);
+   sesc_spawn(threadFunc175, NULL, 0);
+   sesc_spawn(threadFunc176, NULL, 0);
+   sesc_spawn(threadFunc177, NULL, 0);
+   sesc_spawn(threadFunc178, NULL, 0);
+   sesc_spawn(threadFunc179, NULL, 0);
+   sesc_spawn(threadFunc180, NULL, 0);
+   sesc_spawn(threadFunc181, NULL, 0);
+   sesc_spawn(threadFunc182, NULL, 0);
+   sesc_spawn(threadFunc183, NULL, 0);
+   sesc_spawn(threadFunc184, NULL, 0);
+   sesc_spawn(threadFunc185, NULL, 0);
+   sesc_spawn(threadFunc186, NULL, 0);
+   sesc_spawn(threadFunc187, NULL, 0);
+   sesc_spawn(threadFunc188, NULL, 0);
+   sesc_spawn(threadFunc189, NULL, 0);
+   sesc_spawn(threadFunc190, NULL, 0);
+   sesc_spawn(threadFunc191, NULL, 0);
+   sesc_spawn(threadFunc192, NULL, 0);
+   sesc_spawn(threadFunc193, NULL, 0);
+   sesc_spawn(threadFunc194, NULL, 0);
+   sesc_spawn(threadFunc195, NULL, 0);
+   sesc_spawn(threadFunc196, NULL, 0);
+   sesc_spawn(threadFunc197, NULL, 0);
+   sesc_spawn(threadFunc198, NULL, 0);
+   sesc_spawn(threadFunc199, NULL, 0);
+   sesc_spawn(threadFunc200, NULL, 0);
+   sesc_spawn(threadFunc201, NULL, 0);
+   sesc_spawn(threadFunc202, NULL, 0);
+   sesc_spawn(threadFunc203, NULL, 0);
+   sesc_spawn(threadFunc204, NULL, 0);
+   sesc_spawn(threadFunc205, NULL, 0);
+   sesc_spawn(threadFunc206, NULL, 0);
+   sesc_spawn(threadFunc207, NULL, 0);
+   sesc_spawn(threadFunc208, NULL, 0);
+   sesc_spawn(threadFunc209, NULL, 0);
+   sesc_spawn(threadFunc210, NULL, 0);
+   sesc_spawn(threadFunc211, NULL, 0);
+   sesc_spawn(threadFunc212, NULL, 0);
+   sesc_spawn(threadFunc213, NULL, 0);
+   sesc_spawn(threadFunc214, NULL, 0);
+   sesc_spawn(threadFunc215, NULL, 0);
+   sesc_spawn(threadFunc216, NULL, 0);
+   sesc_spawn(threadFunc217, NULL, 0);
+   sesc_spawn(threadFunc218, NULL, 0);
+   sesc_spawn(threadFunc219, NULL, 0);
+   sesc_spawn(threadFunc220, NULL, 0);
+   sesc_spawn(threadFunc221, NULL, 0);
+   sesc_spawn(threadFunc222, NULL, 0);
+   sesc_spawn(threadFunc223, NULL, 0);
+   sesc_spawn(threadFunc224, NULL, 0);
+   sesc_spawn(threadFunc225, NULL, 0);
+   sesc_spawn(threadFunc226, NULL, 0);
+   sesc_spawn(threadFunc227, NULL, 0);
+   sesc_spawn(threadFunc228, NULL, 0);
+   sesc_spawn(threadFunc229, NULL, 0);
+   sesc_spawn(threadFunc230, NULL, 0);
+   sesc_spawn(threadFunc231, NULL, 0);
+   sesc_spawn(threadFunc232, NULL, 0);
+   sesc_spawn(threadFunc233, NULL, 0);
+   sesc_spawn(threadFunc234, NULL, 0);
+   sesc_spawn(threadFunc235, NULL, 0);
+   sesc_spawn(threadFunc236, NULL, 0);
+   sesc_spawn(threadFunc237, NULL, 0);
+   sesc_spawn(threadFunc238, NULL, 0);
+   sesc_spawn(threadFunc239, NULL, 0);
+   sesc_spawn(threadFunc240, NULL, 0);
+   sesc_spawn(threadFunc241, NULL, 0);
+   sesc_spawn(threadFunc242, NULL, 0);
+   sesc_spawn(threadFunc243, NULL, 0);
+   sesc_spawn(threadFunc244, NULL, 0);
+   sesc_spawn(threadFunc245, NULL, 0);
+   sesc_spawn(threadFunc246, NULL, 0);
+   sesc_spawn(threadFunc247, NULL, 0);
+   sesc_spawn(threadFunc248, NULL, 0);
+   sesc_spawn(threadFunc249, NULL, 0);
+   sesc_spawn(threadFunc250, NULL, 0);
+   sesc_spawn(threadFunc251, NULL, 0);
+   sesc_spawn(threadFunc252, NULL, 0);
+   sesc_spawn(threadFunc253, NULL, 0);
+   sesc_spawn(threadFunc254, NULL, 0);
+   sesc_spawn(threadFunc255, NULL, 0);
+   sesc_spawn(threadFunc256, NULL, 0);
+   sesc_spawn(threadFunc257, NULL, 0);
+   sesc_spawn(threadFunc258, NULL, 0);
+   sesc_spawn(threadFunc259, NULL, 0);
+   sesc_spawn(threadFunc260, NULL, 0);
+   sesc_spawn(threadFunc261, NULL, 0);
+   sesc_spawn(threadFunc262, NULL, 0);
+   sesc_spawn(threadFunc263, NULL, 0);
+   sesc_spawn(threadFunc264, NULL, 0);
+   sesc_spawn(threadFunc265, NULL, 0);
+   sesc_spawn(threadFunc266, NULL, 0);
+   sesc_spawn(threadFunc267, NULL, 0);
+   sesc_spawn(threadFunc268, NULL, 0);
+   sesc_spawn(threadFunc269, NULL, 0);
+   sesc_spawn(threadFunc270, NULL, 0);
+   sesc_spawn(threadFunc271, NULL, 0);
+   sesc_spawn(threadFunc272, NULL, 0);
+   sesc_spawn(threadFunc273, NULL, 0);
+   sesc_spawn(threadFunc274, NULL, 0);
+   sesc_spawn(threadFunc275, NULL, 0);
+   sesc_spawn(threadFunc276, NULL, 0);
+   sesc_spawn(threadFunc277, NULL, 0);
+   sesc_spawn(threadFunc278, NULL, 0);
+   sesc_spawn(threadFunc279, NULL, 0);
+   sesc_spawn(threadFunc280, NULL, 0);
+   sesc_spawn(threadFunc281, NULL, 0);
+   sesc_spawn(threadFunc282, NULL, 0);
+   sesc_spawn(threadFunc283, NULL, 0);
+   sesc_spawn(threadFunc284, NULL, 0);
+   sesc_spawn(threadFunc285, NULL, 0);
+   sesc_spawn(threadFunc286, NULL, 0);
+   sesc_spawn(threadFunc287, NULL, 0);
+   sesc_spawn(threadFunc288, NULL, 0);
+   sesc_spawn(threadFunc289, NULL, 0);
+   sesc_spawn(threadFunc290, NULL, 0);
+   sesc_spawn(threadFunc291, NULL, 0);
+   sesc_spawn(threadFunc292, NULL, 0);
+   sesc_spawn(threadFunc293, NULL, 0);
+   sesc_spawn(threadFunc294, NULL, 0);
+   sesc_spawn(threadFunc295, NULL, 0);
+   sesc_spawn(threadFunc296, NULL, 0);
+   sesc_spawn(threadFunc297, NULL, 0);
+   sesc_spawn(threadFunc298, NULL, 0);
+   sesc_spawn(threadFunc299, NULL, 0);
+   sesc_spawn(threadFunc300, NULL, 0);
+   sesc_spawn(threadFunc301, NULL, 0);
+   sesc_spawn(threadFunc302, NULL, 0);
+   sesc_spawn(threadFunc303, NULL, 0);
+   sesc_spawn(threadFunc304, NULL, 0);
+   sesc_spawn(threadFunc305, NULL, 0);
+   sesc_spawn(threadFunc306, NULL, 0);
+   sesc_spawn(threadFunc307, NULL, 0);
+   sesc_spawn(threadFunc308, NULL, 0);
+   sesc_spawn(threadFunc309, NULL, 0);
+   sesc_spawn(threadFunc310, NULL, 0);
+   sesc_spawn(threadFunc311, NULL, 0);
+   sesc_spawn(threadFunc312, NULL, 0);
+   sesc_spawn(threadFunc313, NULL, 0);
+   sesc_spawn(threadFunc314, NULL, 0);
+   sesc_spawn(threadFunc315, NULL, 0);
+   sesc_spawn(threadFunc316, NULL, 0);
+   sesc_spawn(threadFunc317, NULL, 0);
+   sesc_spawn(threadFunc318, NULL, 0);
+   sesc_spawn(threadFunc319, NULL, 0);
+   sesc_spawn(threadFunc320, NULL, 0);
+   sesc_spawn(threadFunc321, NULL, 0);
+   sesc_spawn(threadFunc322, NULL, 0);
+   sesc_spawn(threadFunc323, NULL, 0);
+   sesc_spawn(threadFunc324, NULL, 0);
+   sesc_spawn(threadFunc325, NULL, 0);
+   sesc_spawn(threadFunc326, NULL, 0);
+   sesc_spawn(threadFunc327, NULL, 0);
+   sesc_spawn(threadFunc328, NULL, 0);
+   sesc_spawn(threadFunc329, NULL, 0);
+   sesc_spawn(threadFunc330, NULL, 0);
+   sesc_spawn(threadFunc331, NULL, 0);
+   sesc_spawn(threadFunc332, NULL, 0);
+   sesc_spawn(threadFunc333, NULL, 0);
+   sesc_spawn(threadFunc334, NULL, 0);
+   sesc_spawn(threadFunc335, NULL, 0);
+   sesc_spawn(threadFunc336, NULL, 0);
+   sesc_spawn(threadFunc337, NULL, 0);
+   sesc_spawn(threadFunc338, NULL, 0);
+   sesc_spawn(threadFunc339, NULL, 0);
+   sesc_spawn(threadFunc340, NULL, 0);
+   sesc_spawn(threadFunc341, NULL, 0);
+   sesc_spawn(threadFunc342, NULL, 0);
+   sesc_spawn(threadFunc343, NULL, 0);
+   sesc_spawn(threadFunc344, NULL, 0);
+   sesc_spawn(threadFunc345, NULL, 0);
+   sesc_spawn(threadFunc346, NULL, 0);
+   sesc_spawn(threadFunc347, NULL, 0);
+   sesc_spawn(threadFunc348, NULL, 0);
+   sesc_spawn(threadFunc349, NULL, 0);
+   sesc_spawn(threadFunc350, NULL, 0);
+   sesc_spawn(threadFunc351, NULL, 0);
+   sesc_spawn(threadFunc352, NULL, 0);
+   sesc_spawn(threadFunc353, NULL, 0);
+   sesc_spawn(threadFunc354, NULL, 0);
+   sesc_spawn(threadFunc355, NULL, 0);
+   sesc_spawn(threadFunc356, NULL, 0);
+   sesc_spawn(threadFunc357, NULL, 0);
+   sesc_spawn(threadFunc358, NULL, 0);
+   sesc_spawn(threadFunc359, NULL, 0);
+   sesc_spawn(threadFunc360, NULL, 0);
+   sesc_spawn(threadFunc361, NULL, 0);
+   sesc_spawn(threadFunc362, NULL, 0);
+   sesc_spawn(threadFunc363, NULL, 0);
+   sesc_spawn(threadFunc364, NULL, 0);
+   sesc_spawn(threadFunc365, NULL, 0);
+   sesc_spawn(threadFunc366, NULL, 0);
+   sesc_spawn(threadFunc367, NULL, 0);
+   sesc_spawn(threadFunc368, NULL, 0);
+   sesc_spawn(threadFunc369, NULL, 0);
+   sesc_spawn(threadFunc370, NULL, 0);
+   sesc_spawn(threadFunc371, NULL, 0);
+   sesc_spawn(threadFunc372, NULL, 0);
+   sesc_spawn(threadFunc373, NULL, 0);
+   sesc_spawn(threadFunc374, NULL, 0);
+   sesc_spawn(threadFunc375, NULL, 0);
+   sesc_spawn(threadFunc376, NULL, 0);
+   sesc_spawn(threadFunc377, NULL, 0);
+   sesc_spawn(threadFunc378, NULL, 0);
+   sesc_spawn(threadFunc379, NULL, 0);
+   sesc_spawn(threadFunc380, NULL, 0);
+   sesc_spawn(threadFunc381, NULL, 0);
+   sesc_spawn(threadFunc382, NULL, 0);
+   sesc_spawn(threadFunc383, NULL, 0);
+   sesc_spawn(threadFunc384, NULL, 0);
+   sesc_spawn(threadFunc385, NULL, 0);
+   sesc_spawn(threadFunc386, NULL, 0);
+   sesc_spawn(threadFunc387, NULL, 0);
+   sesc_spawn(threadFunc388, NULL, 0);
+   sesc_spawn(threadFunc389, NULL, 0);
+   sesc_spawn(threadFunc390, NULL, 0);
+   sesc_spawn(threadFunc391, NULL, 0);
+   sesc_spawn(threadFunc392, NULL, 0);
+   sesc_spawn(threadFunc393, NULL, 0);
+   sesc_spawn(threadFunc394, NULL, 0);
+   sesc_spawn(threadFunc395, NULL, 0);
+   sesc_spawn(threadFunc396, NULL, 0);
+   sesc_spawn(threadFunc397, NULL, 0);
+   sesc_spawn(threadFunc398, NULL, 0);
+   sesc_spawn(threadFunc399, NULL, 0);
+   sesc_spawn(threadFunc400, NULL, 0);
+   sesc_spawn(threadFunc401, NULL, 0);
+   sesc_spawn(threadFunc402, NULL, 0);
+   sesc_spawn(threadFunc403, NULL, 0);
+   sesc_spawn(threadFunc404, NULL, 0);
+   sesc_spawn(threadFunc405, NULL, 0);
+   sesc_spawn(threadFunc406, NULL, 0);
+   sesc_spawn(threadFunc407, NULL, 0);
+   sesc_spawn(threadFunc408, NULL, 0);
+   sesc_spawn(threadFunc409, NULL, 0);
+   sesc_spawn(threadFunc410, NULL, 0);
+   sesc_spawn(threadFunc411, NULL, 0);
+   sesc_spawn(threadFunc412, NULL, 0);
+   sesc_spawn(threadFunc413, NULL, 0);
+   sesc_spawn(threadFunc414, NULL, 0);
+   sesc_spawn(threadFunc415, NULL, 0);
+   sesc_spawn(threadFunc416, NULL, 0);
+   sesc_spawn(threadFunc417, NULL, 0);
+   sesc_spawn(threadFunc418, NULL, 0);
+   sesc_spawn(threadFunc419, NULL, 0);
+   sesc_spawn(threadFunc420, NULL, 0);
+   sesc_spawn(threadFunc421, NULL, 0);
+   sesc_spawn(threadFunc422, NULL, 0);
+   sesc_spawn(threadFunc423, NULL, 0);
+   sesc_spawn(threadFunc424, NULL, 0);
+   sesc_spawn(threadFunc425, NULL, 0);
+   sesc_spawn(threadFunc426, NULL, 0);
+   sesc_spawn(threadFunc427, NULL, 0);
+   sesc_spawn(threadFunc428, NULL, 0);
+   sesc_spawn(threadFunc429, NULL, 0);
+   sesc_spawn(threadFunc430, NULL, 0);
+   sesc_spawn(threadFunc431, NULL, 0);
+   sesc_spawn(threadFunc432, NULL, 0);
+   sesc_spawn(threadFunc433, NULL, 0);
+   sesc_spawn(threadFunc434, NULL, 0);
+   sesc_spawn(threadFunc435, NULL, 0);
+   sesc_spawn(threadFunc436, NULL, 0);
+   sesc_spawn(threadFunc437, NULL, 0);
+   sesc_spawn(threadFunc438, NULL, 0);
+   sesc_spawn(threadFunc439, NULL, 0);
+   sesc_spawn(threadFunc440, NULL, 0);
+   sesc_spawn(threadFunc441, NULL, 0);
+   sesc_spawn(threadFunc442, NULL, 0);
+   sesc_spawn(threadFunc443, NULL, 0);
+   sesc_spawn(threadFunc444, NULL, 0);
+   sesc_spawn(threadFunc445, NULL, 0);
+   sesc_spawn(threadFunc446, NULL, 0);
+   sesc_spawn(threadFunc447, NULL, 0);
+   sesc_spawn(threadFunc448, NULL, 0);
+   sesc_spawn(threadFunc449, NULL, 0);
+   sesc_spawn(threadFunc450, NULL, 0);
+   sesc_spawn(threadFunc451, NULL, 0);
+   sesc_spawn(threadFunc452, NULL, 0);
+   sesc_spawn(threadFunc453, NULL, 0);
+   sesc_spawn(threadFunc454, NULL, 0);
+   sesc_spawn(threadFunc455, NULL, 0);
+   sesc_spawn(threadFunc456, NULL, 0);
+   sesc_spawn(threadFunc457, NULL, 0);
+   sesc_spawn(threadFunc458, NULL, 0);
+   sesc_spawn(threadFunc459, NULL, 0);
+   sesc_spawn(threadFunc460, NULL, 0);
+   sesc_spawn(threadFunc461, NULL, 0);
+   sesc_spawn(threadFunc462, NULL, 0);
+   sesc_spawn(threadFunc463, NULL, 0);
+   sesc_spawn(threadFunc464, NULL, 0);
+   sesc_spawn(threadFunc465, NULL, 0);
+   sesc_spawn(threadFunc466, NULL, 0);
+   sesc_spawn(threadFunc467, NULL, 0);
+   sesc_spawn(threadFunc468, NULL, 0);
+   sesc_spawn(threadFunc469, NULL, 0);
+   sesc_spawn(threadFunc470, NULL, 0);
+   sesc_spawn(threadFunc471, NULL, 0);
+   sesc_spawn(threadFunc472, NULL, 0);
+   sesc_spawn(threadFunc473, NULL, 0);
+   sesc_spawn(threadFunc474, NULL, 0);
+   sesc_spawn(threadFunc475, NULL, 0);
+   sesc_spawn(threadFunc476, NULL, 0);
+   sesc_spawn(threadFunc477, NULL, 0);
+   sesc_spawn(threadFunc478, NULL, 0);
+   sesc_spawn(threadFunc479, NULL, 0);
+   sesc_spawn(threadFunc480, NULL, 0);
+   sesc_spawn(threadFunc481, NULL, 0);
+   sesc_spawn(threadFunc482, NULL, 0);
+   sesc_spawn(threadFunc483, NULL, 0);
+   sesc_spawn(threadFunc484, NULL, 0);
+   sesc_spawn(threadFunc485, NULL, 0);
+   sesc_spawn(threadFunc486, NULL, 0);
+   sesc_spawn(threadFunc487, NULL, 0);
+   sesc_spawn(threadFunc488, NULL, 0);
+   sesc_spawn(threadFunc489, NULL, 0);
+   sesc_spawn(threadFunc490, NULL, 0);
+   sesc_spawn(threadFunc491, NULL, 0);
+   sesc_spawn(threadFunc492, NULL, 0);
+   sesc_spawn(threadFunc493, NULL, 0);
+   sesc_spawn(threadFunc494, NULL, 0);
+   sesc_spawn(threadFunc495, NULL, 0);
+   sesc_spawn(threadFunc496, NULL, 0);
+   sesc_spawn(threadFunc497, NULL, 0);
+   sesc_spawn(threadFunc498, NULL, 0);
+   sesc_spawn(threadFunc499, NULL, 0);
+   sesc_spawn(threadFunc500, NULL, 0);
+   sesc_spawn(threadFunc501, NULL, 0);
+   sesc_spawn(threadFunc502, NULL, 0);
+   sesc_spawn(threadFunc503, NULL, 0);
+   sesc_spawn(threadFunc504, NULL, 0);
+   sesc_spawn(threadFunc505, NULL, 0);
+   sesc_spawn(threadFunc506, NULL, 0);
+   sesc_spawn(threadFunc507, NULL, 0);
+   sesc_spawn(threadFunc508, NULL, 0);
+   sesc_spawn(threadFunc509, NULL, 0);
+   sesc_spawn(threadFunc510, NULL, 0);
+   sesc_spawn(threadFunc511, NULL, 0);
+   sesc_spawn(threadFunc512, NULL, 0);
+   sesc_spawn(threadFunc513, NULL, 0);
+   sesc_spawn(threadFunc514, NULL, 0);
+   sesc_spawn(threadFunc515, NULL, 0);
+   sesc_spawn(threadFunc516, NULL, 0);
+   sesc_spawn(threadFunc517, NULL, 0);
+   sesc_spawn(threadFunc518, NULL, 0);
+   sesc_spawn(threadFunc519, NULL, 0);
+   sesc_spawn(threadFunc520, NULL, 0);
+   sesc_spawn(threadFunc521, NULL, 0);
+   sesc_spawn(threadFunc522, NULL, 0);
+   sesc_spawn(threadFunc523, NULL, 0);
+   sesc_spawn(threadFunc524, NULL, 0);
+   sesc_spawn(threadFunc525, NULL, 0);
+   sesc_spawn(threadFunc526, NULL, 0);
+   sesc_spawn(threadFunc527, NULL, 0);
+   sesc_spawn(threadFunc528, NULL, 0);
+   sesc_spawn(threadFunc529, NULL, 0);
+   sesc_spawn(threadFunc530, NULL, 0);
+   sesc_spawn(threadFunc531, NULL, 0);
+   sesc_spawn(threadFunc532, NULL, 0);
+   sesc_spawn(threadFunc533, NULL, 0);
+   sesc_spawn(threadFunc534, NULL, 0);
+   sesc_spawn(threadFunc535, NULL, 0);
+   sesc_spawn(threadFunc536, NULL, 0);
+   sesc_spawn(threadFunc537, NULL, 0);
+   sesc_spawn(threadFunc538, NULL, 0);
+   sesc_spawn(threadFunc539, NULL, 0);
+   sesc_spawn(threadFunc540, NULL, 0);
+   sesc_spawn(threadFunc541, NULL, 0);
+   sesc_spawn(threadFunc542, NULL, 0);
+   sesc_spawn(threadFunc543, NULL, 0);
+   sesc_spawn(threadFunc544, NULL, 0);
+   sesc_spawn(threadFunc545, NULL, 0);
+   sesc_spawn(threadFunc546, NULL, 0);
+   sesc_spawn(threadFunc547, NULL, 0);
+   sesc_spawn(threadFunc548, NULL, 0);
+   sesc_spawn(threadFunc549, NULL, 0);
+   sesc_spawn(threadFunc550, NULL, 0);
+   sesc_spawn(threadFunc551, NULL, 0);
+   sesc_spawn(threadFunc552, NULL, 0);
+   sesc_spawn(threadFunc553, NULL, 0);
+   sesc_spawn(threadFunc554, NULL, 0);
+   sesc_spawn(threadFunc555, NULL, 0);
+   sesc_spawn(threadFunc556, NULL, 0);
+   sesc_spawn(threadFunc557, NULL, 0);
+   sesc_spawn(threadFunc558, NULL, 0);
+   sesc_spawn(threadFunc559, NULL, 0);
+   sesc_spawn(threadFunc560, NULL, 0);
+   sesc_spawn(threadFunc561, NULL, 0);
+   sesc_spawn(threadFunc562, NULL, 0);
+   sesc_spawn(threadFunc563, NULL, 0);
+   sesc_spawn(threadFunc564, NULL, 0);
+   sesc_spawn(threadFunc565, NULL, 0);
+   sesc_spawn(threadFunc566, NULL, 0);
+   sesc_spawn(threadFunc567, NULL, 0);
+   sesc_spawn(threadFunc568, NULL, 0);
+   sesc_spawn(threadFunc569, NULL, 0);
+   sesc_spawn(threadFunc570, NULL, 0);
+   sesc_spawn(threadFunc571, NULL, 0);
+   sesc_spawn(threadFunc572, NULL, 0);
+   sesc_spawn(threadFunc573, NULL, 0);
+   sesc_spawn(threadFunc574, NULL, 0);
+   sesc_spawn(threadFunc575, NULL, 0);
+   sesc_spawn(threadFunc576, NULL, 0);
+   sesc_spawn(threadFunc577, NULL, 0);
+   sesc_spawn(threadFunc578, NULL, 0);
+   sesc_spawn(threadFunc579, NULL, 0);
+   sesc_spawn(threadFunc580, NULL, 0);
+   sesc_spawn(threadFunc581, NULL, 0);
+   sesc_spawn(threadFunc582, NULL, 0);
+   sesc_spawn(threadFunc583, NULL, 0);
+   sesc_spawn(threadFunc584, NULL, 0);
+   sesc_spawn(threadFunc585, NULL, 0);
+   sesc_spawn(threadFunc586, NULL, 0);
+   sesc_spawn(threadFunc587, NULL, 0);
+   sesc_spawn(threadFunc588, NULL, 0);
+   sesc_spawn(threadFunc589, NULL, 0);
+   sesc_spawn(threadFunc590, NULL, 0);
+   sesc_spawn(threadFunc591, NULL, 0);
+   sesc_spawn(threadFunc592, NULL, 0);
+   sesc_spawn(threadFunc593, NULL, 0);
+   sesc_spawn(threadFunc594, NULL, 0);
+   sesc_spawn(threadFunc595, NULL, 0);
+   sesc_spawn(threadFunc596, NULL, 0);
+   sesc_spawn(threadFunc597, NULL, 0);
+   sesc_spawn(threadFunc598, NULL, 0);
+   sesc_spawn(threadFunc599, NULL, 0);
+   sesc_spawn(threadFunc600, NULL, 0);
+   sesc_spawn(threadFunc601, NULL, 0);
+   sesc_spawn(threadFunc602, NULL, 0);
+   sesc_spawn(threadFunc603, NULL, 0);
+   sesc_spawn(threadFunc604, NULL, 0);
+   sesc_spawn(threadFunc605, NULL, 0);
+   sesc_spawn(threadFunc606, NULL, 0);
+   sesc_spawn(threadFunc607, NULL, 0);
+   sesc_spawn(threadFunc608, NULL, 0);
+   sesc_spawn(threadFunc609, NULL, 0);
+   sesc_spawn(threadFunc610, NULL, 0);
+   sesc_spawn(threadFunc611, NULL, 0);
+   sesc_spawn(threadFunc612, NULL, 0);
+   sesc_spawn(threadFunc613, NULL, 0);
+   sesc_spawn(threadFunc614, NULL, 0);
+   sesc_spawn(threadFunc615, NULL, 0);
+   sesc_spawn(threadFunc616, NULL, 0);
+   sesc_spawn(threadFunc617, NULL, 0);
+   sesc_spawn(threadFunc618, NULL, 0);
+   sesc_spawn(threadFunc619, NULL, 0);
+   sesc_spawn(threadFunc620, NULL, 0);
+   sesc_spawn(threadFunc621, NULL, 0);
+   sesc_spawn(threadFunc622, NULL, 0);
+   sesc_spawn(threadFunc623, NULL, 0);
+   sesc_spawn(threadFunc624, NULL, 0);
+   sesc_spawn(threadFunc625, NULL, 0);
+   sesc_spawn(threadFunc626, NULL, 0);
+   sesc_spawn(threadFunc627, NULL, 0);
+   sesc_spawn(threadFunc628, NULL, 0);
+   sesc_spawn(threadFunc629, NULL, 0);
+   sesc_spawn(threadFunc630, NULL, 0);
+   sesc_spawn(threadFunc631, NULL, 0);
+   sesc_spawn(threadFunc632, NULL, 0);
+   sesc_spawn(threadFunc633, NULL, 0);
+   sesc_spawn(threadFunc634, NULL, 0);
+   sesc_spawn(threadFunc635, NULL, 0);
+   sesc_spawn(threadFunc636, NULL, 0);
+   sesc_spawn(threadFunc637, NULL, 0);
+   sesc_spawn(threadFunc638, NULL, 0);
+   sesc_spawn(threadFunc639, NULL, 0);
+   sesc_spawn(threadFunc640, NULL, 0);
+   sesc_spawn(threadFunc641, NULL, 0);
+   sesc_spawn(threadFunc642, NULL, 0);
+   sesc_spawn(threadFunc643, NULL, 0);
+   sesc_spawn(threadFunc644, NULL, 0);
+   sesc_spawn(threadFunc645, NULL, 0);
+   sesc_spawn(threadFunc646, NULL, 0);
+   sesc_spawn(threadFunc647, NULL, 0);
+   sesc_spawn(threadFunc648, NULL, 0);
+   sesc_spawn(threadFunc649, NULL, 0);
+   sesc_spawn(threadFunc650, NULL, 0);
+   sesc_spawn(threadFunc651, NULL, 0);
+   sesc_spawn(threadFunc652, NULL, 0);
+   sesc_spawn(threadFunc653, NULL, 0);
+   sesc_spawn(threadFunc654, NULL, 0);
+   sesc_spawn(threadFunc655, NULL, 0);
+   sesc_spawn(threadFunc656, NULL, 0);
+   sesc_spawn(threadFunc657, NULL, 0);
+   sesc_spawn(threadFunc658, NULL, 0);
+   sesc_spawn(threadFunc659, NULL, 0);
+   sesc_spawn(threadFunc660, NULL, 0);
+   sesc_spawn(threadFunc661, NULL, 0);
+   sesc_spawn(threadFunc662, NULL, 0);
+   sesc_spawn(threadFunc663, NULL, 0);
+   sesc_spawn(threadFunc664, NULL, 0);
+   sesc_spawn(threadFunc665, NULL, 0);
+   sesc_spawn(threadFunc666, NULL, 0);
+   sesc_spawn(threadFunc667, NULL, 0);
+   sesc_spawn(threadFunc668, NULL, 0);
+   sesc_spawn(threadFunc669, NULL, 0);
+   sesc_spawn(threadFunc670, NULL, 0);
+   sesc_spawn(threadFunc671, NULL, 0);
+   sesc_spawn(threadFunc672, NULL, 0);
+   sesc_spawn(threadFunc673, NULL, 0);
+   sesc_spawn(threadFunc674, NULL, 0);
+   sesc_spawn(threadFunc675, NULL, 0);
+   sesc_spawn(threadFunc676, NULL, 0);
+   sesc_spawn(threadFunc677, NULL, 0);
+   sesc_spawn(threadFunc678, NULL, 0);
+   sesc_spawn(threadFunc679, NULL, 0);
+   sesc_spawn(threadFunc680, NULL, 0);
+   sesc_spawn(threadFunc681, NULL, 0);
+   sesc_spawn(threadFunc682, NULL, 0);
+   sesc_spawn(threadFunc683, NULL, 0);
+   sesc_spawn(threadFunc684, NULL, 0);
+   sesc_spawn(threadFunc685, NULL, 0);
+   sesc_spawn(threadFunc686, NULL, 0);
+   sesc_spawn(threadFunc687, NULL, 0);
+   sesc_spawn(threadFunc688, NULL, 0);
+   sesc_spawn(threadFunc689, NULL, 0);
+   sesc_spawn(threadFunc690, NULL, 0);
+   sesc_spawn(threadFunc691, NULL, 0);
+   sesc_spawn(threadFunc692, NULL, 0);
+   sesc_spawn(threadFunc693, NULL, 0);
+   sesc_spawn(threadFunc694, NULL, 0);
+   sesc_spawn(threadFunc695, NULL, 0);
+   sesc_spawn(threadFunc696, NULL, 0);
+   sesc_spawn(threadFunc697, NULL, 0);
+   sesc_spawn(threadFunc698, NULL, 0);
+   sesc_spawn(threadFunc699, NULL, 0);
+   sesc_spawn(threadFunc700, NULL, 0);
+   sesc_spawn(threadFunc701, NULL, 0);
+   sesc_spawn(threadFunc702, NULL, 0);
+   sesc_spawn(threadFunc703, NULL, 0);
+   sesc_spawn(threadFunc704, NULL, 0);
+   sesc_spawn(threadFunc705, NULL, 0);
+   sesc_spawn(threadFunc706, NULL, 0);
+   sesc_spawn(threadFunc707, NULL, 0);
+   sesc_spawn(threadFunc708, NULL, 0);
+   sesc_spawn(threadFunc709, NULL, 0);
+   sesc_spawn(threadFunc710, NULL, 0);
+   sesc_spawn(threadFunc711, NULL, 0);
+   sesc_spawn(threadFunc712, NULL, 0);
+   sesc_spawn(threadFunc713, NULL, 0);
+   sesc_spawn(threadFunc714, NULL, 0);
+   sesc_spawn(threadFunc715, NULL, 0);
+   sesc_spawn(threadFunc716, NULL, 0);
+   sesc_spawn(threadFunc717, NULL, 0);
+   sesc_spawn(threadFunc718, NULL, 0);
+   sesc_spawn(threadFunc719, NULL, 0);
+   sesc_spawn(threadFunc720, NULL, 0);
+   sesc_spawn(threadFunc721, NULL, 0);
+   sesc_spawn(threadFunc722, NULL, 0);
+   sesc_spawn(threadFunc723, NULL, 0);
+   sesc_spawn(threadFunc724, NULL, 0);
+   sesc_spawn(threadFunc725, NULL, 0);
+   sesc_spawn(threadFunc726, NULL, 0);
+   sesc_spawn(threadFunc727, NULL, 0);
+   sesc_spawn(threadFunc728, NULL, 0);
+   sesc_spawn(threadFunc729, NULL, 0);
+   sesc_spawn(threadFunc730, NULL, 0);
+   sesc_spawn(threadFunc731, NULL, 0);
+   sesc_spawn(threadFunc732, NULL, 0);
+   sesc_spawn(threadFunc733, NULL, 0);
+   sesc_spawn(threadFunc734, NULL, 0);
+   sesc_spawn(threadFunc735, NULL, 0);
+   sesc_spawn(threadFunc736, NULL, 0);
+   sesc_spawn(threadFunc737, NULL, 0);
+   sesc_spawn(threadFunc738, NULL, 0);
+   sesc_spawn(threadFunc739, NULL, 0);
+   sesc_spawn(threadFunc740, NULL, 0);
+   sesc_spawn(threadFunc741, NULL, 0);
+   sesc_spawn(threadFunc742, NULL, 0);
+   sesc_spawn(threadFunc743, NULL, 0);
+   sesc_spawn(threadFunc744, NULL, 0);
+   sesc_spawn(threadFunc745, NULL, 0);
+   sesc_spawn(threadFunc746, NULL, 0);
+   sesc_spawn(threadFunc747, NULL, 0);
+   sesc_spawn(threadFunc748, NULL, 0);
+   sesc_spawn(threadFunc749, NULL, 0);
+   sesc_spawn(threadFunc750, NULL, 0);
+   sesc_spawn(threadFunc751, NULL, 0);
+   sesc_spawn(threadFunc752, NULL, 0);
+   sesc_spawn(threadFunc753, NULL, 0);
+   sesc_spawn(threadFunc754, NULL, 0);
+   sesc_spawn(threadFunc755, NULL, 0);
+   sesc_spawn(threadFunc756, NULL, 0);
+   sesc_spawn(threadFunc757, NULL, 0);
+   sesc_spawn(threadFunc758, NULL, 0);
+   sesc_spawn(threadFunc759, NULL, 0);
+   sesc_spawn(threadFunc760, NULL, 0);
+   sesc_spawn(threadFunc761, NULL, 0);
+   sesc_spawn(threadFunc762, NULL, 0);
+   sesc_spawn(threadFunc763, NULL, 0);
+   sesc_spawn(threadFunc764, NULL, 0);
+   sesc_spawn(threadFunc765, NULL, 0);
+   sesc_spawn(threadFunc766, NULL, 0);
+   sesc_spawn(threadFunc767, NULL, 0);
+   sesc_spawn(threadFunc768, NULL, 0);
+   sesc_spawn(threadFunc769, NULL, 0);
+   sesc_spawn(threadFunc770, NULL, 0);
+   sesc_spawn(threadFunc771, NULL, 0);
+   sesc_spawn(threadFunc772, NULL, 0);
+   sesc_spawn(threadFunc773, NULL, 0);
+   sesc_spawn(threadFunc774, NULL, 0);
+   sesc_spawn(threadFunc775, NULL, 0);
+   sesc_spawn(threadFunc776, NULL, 0);
+   sesc_spawn(threadFunc777, NULL, 0);
+   sesc_spawn(threadFunc778, NULL, 0);
+   sesc_spawn(threadFunc779, NULL, 0);
+   sesc_spawn(threadFunc780, NULL, 0);
+   sesc_spawn(threadFunc781, NULL, 0);
+   sesc_spawn(threadFunc782, NULL, 0);
+   sesc_spawn(threadFunc783, NULL, 0);
+   sesc_spawn(threadFunc784, NULL, 0);
+   sesc_spawn(threadFunc785, NULL, 0);
+   sesc_spawn(threadFunc786, NULL, 0);
+   sesc_spawn(threadFunc787, NULL, 0);
+   sesc_spawn(threadFunc788, NULL, 0);
+   sesc_spawn(threadFunc789, NULL, 0);
+   sesc_spawn(threadFunc790, NULL, 0);
+   sesc_spawn(threadFunc791, NULL, 0);
+   sesc_spawn(threadFunc792, NULL, 0);
+   sesc_spawn(threadFunc793, NULL, 0);
+   sesc_spawn(threadFunc794, NULL, 0);
+   sesc_spawn(threadFunc795, NULL, 0);
+   sesc_spawn(threadFunc796, NULL, 0);
+   sesc_spawn(threadFunc797, NULL, 0);
+   sesc_spawn(threadFunc798, NULL, 0);
+   sesc_spawn(threadFunc799, NULL, 0);
+   sesc_spawn(threadFunc800, NULL, 0);
+   sesc_spawn(threadFunc801, NULL, 0);
+   sesc_spawn(threadFunc802, NULL, 0);
+   sesc_spawn(threadFunc803, NULL, 0);
+   sesc_spawn(threadFunc804, NULL, 0);
+   sesc_spawn(threadFunc805, NULL, 0);
+   sesc_spawn(threadFunc806, NULL, 0);
+   sesc_spawn(threadFunc807, NULL, 0);
+   sesc_spawn(threadFunc808, NULL, 0);
+   sesc_spawn(threadFunc809, NULL, 0);
+   sesc_spawn(threadFunc810, NULL, 0);
+   sesc_spawn(threadFunc811, NULL, 0);
+   sesc_spawn(threadFunc812, NULL, 0);
+   sesc_spawn(threadFunc813, NULL, 0);
+   sesc_spawn(threadFunc814, NULL, 0);
+   sesc_spawn(threadFunc815, NULL, 0);
+   sesc_spawn(threadFunc816, NULL, 0);
+   sesc_spawn(threadFunc817, NULL, 0);
+   sesc_spawn(threadFunc818, NULL, 0);
+   sesc_spawn(threadFunc819, NULL, 0);
+   sesc_spawn(threadFunc820, NULL, 0);
+   sesc_spawn(threadFunc821, NULL, 0);
+   sesc_spawn(threadFunc822, NULL, 0);
+   sesc_spawn(threadFunc823, NULL, 0);
+   sesc_spawn(threadFunc824, NULL, 0);
+   sesc_spawn(threadFunc825, NULL, 0);
+   sesc_spawn(threadFunc826, NULL, 0);
+   sesc_spawn(threadFunc827, NULL, 0);
+   sesc_spawn(threadFunc828, NULL, 0);
+   sesc_spawn(threadFunc829, NULL, 0);
+   sesc_spawn(threadFunc830, NULL, 0);
+   sesc_spawn(threadFunc831, NULL, 0);
+   sesc_spawn(threadFunc832, NULL, 0);
+   sesc_spawn(threadFunc833, NULL, 0);
+   sesc_spawn(threadFunc834, NULL, 0);
+   sesc_spawn(threadFunc835, NULL, 0);
+   sesc_spawn(threadFunc836, NULL, 0);
+   sesc_spawn(threadFunc837, NULL, 0);
+   sesc_spawn(threadFunc838, NULL, 0);
+   sesc_spawn(threadFunc839, NULL, 0);
+   sesc_spawn(threadFunc840, NULL, 0);
+   sesc_spawn(threadFunc841, NULL, 0);
+   sesc_spawn(threadFunc842, NULL, 0);
+   sesc_spawn(threadFunc843, NULL, 0);
+   sesc_spawn(threadFunc844, NULL, 0);
+   sesc_spawn(threadFunc845, NULL, 0);
+   sesc_spawn(threadFunc846, NULL, 0);
+   sesc_spawn(threadFunc847, NULL, 0);
+   sesc_spawn(threadFunc848, NULL, 0);
+   sesc_spawn(threadFunc849, NULL, 0);
+   sesc_spawn(threadFunc850, NULL, 0);
+   sesc_spawn(threadFunc851, NULL, 0);
+   sesc_spawn(threadFunc852, NULL, 0);
+   sesc_spawn(threadFunc853, NULL, 0);
+   sesc_spawn(threadFunc854, NULL, 0);
+   sesc_spawn(threadFunc855, NULL, 0);
+   sesc_spawn(threadFunc856, NULL, 0);
+   sesc_spawn(threadFunc857, NULL, 0);
+   sesc_spawn(threadFunc858, NULL, 0);
+   sesc_spawn(threadFunc859, NULL, 0);
+   sesc_spawn(threadFunc860, NULL, 0);
+   sesc_spawn(threadFunc861, NULL, 0);
+   sesc_spawn(threadFunc862, NULL, 0);
+   sesc_spawn(threadFunc863, NULL, 0);
+   sesc_spawn(threadFunc864, NULL, 0);
+   sesc_spawn(threadFunc865, NULL, 0);
+   sesc_spawn(threadFunc866, NULL, 0);
+   sesc_spawn(threadFunc867, NULL, 0);
+   sesc_spawn(threadFunc868, NULL, 0);
+   sesc_spawn(threadFunc869, NULL, 0);
+   sesc_spawn(threadFunc870, NULL, 0);
+   sesc_spawn(threadFunc871, NULL, 0);
+   sesc_spawn(threadFunc872, NULL, 0);
+   sesc_spawn(threadFunc873, NULL, 0);
+   sesc_spawn(threadFunc874, NULL, 0);
+   sesc_spawn(threadFunc875, NULL, 0);
+   sesc_spawn(threadFunc876, NULL, 0);
+   sesc_spawn(threadFunc877, NULL, 0);
+   sesc_spawn(threadFunc878, NULL, 0);
+   sesc_spawn(threadFunc879, NULL, 0);
+   sesc_spawn(threadFunc880, NULL, 0);
+   sesc_spawn(threadFunc881, NULL, 0);
+   sesc_spawn(threadFunc882, NULL, 0);
+   sesc_spawn(threadFunc883, NULL, 0);
+   sesc_spawn(threadFunc884, NULL, 0);
+   sesc_spawn(threadFunc885, NULL, 0);
+   sesc_spawn(threadFunc886, NULL, 0);
+   sesc_spawn(threadFunc887, NULL, 0);
+   sesc_spawn(threadFunc888, NULL, 0);
+   sesc_spawn(threadFunc889, NULL, 0);
+   sesc_spawn(threadFunc890, NULL, 0);
+   sesc_spawn(threadFunc891, NULL, 0);
+   sesc_spawn(threadFunc892, NULL, 0);
+   sesc_spawn(threadFunc893, NULL, 0);
+   sesc_spawn(threadFunc894, NULL, 0);
+   sesc_spawn(threadFunc895, NULL, 0);
+   sesc_spawn(threadFunc896, NULL, 0);
+   sesc_spawn(threadFunc897, NULL, 0);
+   sesc_spawn(threadFunc898, NULL, 0);
+   sesc_spawn(threadFunc899, NULL, 0);
+   sesc_spawn(threadFunc900, NULL, 0);
+   sesc_spawn(threadFunc901, NULL, 0);
+   sesc_spawn(threadFunc902, NULL, 0);
+   sesc_spawn(threadFunc903, NULL, 0);
+   sesc_spawn(threadFunc904, NULL, 0);
+   sesc_spawn(threadFunc905, NULL, 0);
+   sesc_spawn(threadFunc906, NULL, 0);
+   sesc_spawn(threadFunc907, NULL, 0);
+   sesc_spawn(threadFunc908, NULL, 0);
+   sesc_spawn(threadFunc909, NULL, 0);
+   sesc_spawn(threadFunc910, NULL, 0);
+   sesc_spawn(threadFunc911, NULL, 0);
+   sesc_spawn(threadFunc912, NULL, 0);
+   sesc_spawn(threadFunc913, NULL, 0);
+   sesc_spawn(threadFunc914, NULL, 0);
+   sesc_spawn(threadFunc915, NULL, 0);
+   sesc_spawn(threadFunc916, NULL, 0);
+   sesc_spawn(threadFunc917, NULL, 0);
+   sesc_spawn(threadFunc918, NULL, 0);
+   sesc_spawn(threadFunc919, NULL, 0);
+   sesc_spawn(threadFunc920, NULL, 0);
+   sesc_spawn(threadFunc921, NULL, 0);
+   sesc_spawn(threadFunc922, NULL, 0);
+   sesc_spawn(threadFunc923, NULL, 0);
+   sesc_spawn(threadFunc924, NULL, 0);
+   sesc_spawn(threadFunc925, NULL, 0);
+   sesc_spawn(threadFunc926, NULL, 0);
+   sesc_spawn(threadFunc927, NULL, 0);
+   sesc_spawn(threadFunc928, NULL, 0);
+   sesc_spawn(threadFunc929, NULL, 0);
+   sesc_spawn(threadFunc930, NULL, 0);
+   sesc_spawn(threadFunc931, NULL, 0);
+   sesc_spawn(threadFunc932, NULL, 0);
+   sesc_spawn(threadFunc933, NULL, 0);
+   sesc_spawn(threadFunc934, NULL, 0);
+   sesc_spawn(threadFunc935, NULL, 0);
+   sesc_spawn(threadFunc936, NULL, 0);
+   sesc_spawn(threadFunc937, NULL, 0);
+   sesc_spawn(threadFunc938, NULL, 0);
+   sesc_spawn(threadFunc939, NULL, 0);
+   sesc_spawn(threadFunc940, NULL, 0);
+   sesc_spawn(threadFunc941, NULL, 0);
+   sesc_spawn(threadFunc942, NULL, 0);
+   sesc_spawn(threadFunc943, NULL, 0);
+   sesc_spawn(threadFunc944, NULL, 0);
+   sesc_spawn(threadFunc945, NULL, 0);
+   sesc_spawn(threadFunc946, NULL, 0);
+   sesc_spawn(threadFunc947, NULL, 0);
+   sesc_spawn(threadFunc948, NULL, 0);
+   sesc_spawn(threadFunc949, NULL, 0);
+   sesc_spawn(threadFunc950, NULL, 0);
+   sesc_spawn(threadFunc951, NULL, 0);
+   sesc_spawn(threadFunc952, NULL, 0);
+   sesc_spawn(threadFunc953, NULL, 0);
+   sesc_spawn(threadFunc954, NULL, 0);
+   sesc_spawn(threadFunc955, NULL, 0);
+   sesc_spawn(threadFunc956, NULL, 0);
+   sesc_spawn(threadFunc957, NULL, 0);
+   sesc_spawn(threadFunc958, NULL, 0);
+   sesc_spawn(threadFunc959, NULL, 0);
+   sesc_spawn(threadFunc960, NULL, 0);
+   sesc_spawn(threadFunc961, NULL, 0);
+   sesc_spawn(threadFunc962, NULL, 0);
+   sesc_spawn(threadFunc963, NULL, 0);
+   sesc_spawn(threadFunc964, NULL, 0);
+   sesc_spawn(threadFunc965, NULL, 0);
+   sesc_spawn(threadFunc966, NULL, 0);
+   sesc_spawn(threadFunc967, NULL, 0);
+   sesc_spawn(threadFunc968, NULL, 0);
+   sesc_spawn(threadFunc969, NULL, 0);
+   sesc_spawn(threadFunc970, NULL, 0);
+   sesc_spawn(threadFunc971, NULL, 0);
+   sesc_spawn(threadFunc972, NULL, 0);
+   sesc_spawn(threadFunc973, NULL, 0);
+   sesc_spawn(threadFunc974, NULL, 0);
+   sesc_spawn(threadFunc975, NULL, 0);
+   sesc_spawn(threadFunc976, NULL, 0);
+   sesc_spawn(threadFunc977, NULL, 0);
+   sesc_spawn(threadFunc978, NULL, 0);
+   sesc_spawn(threadFunc979, NULL, 0);
+   sesc_spawn(threadFunc980, NULL, 0);
+   sesc_spawn(threadFunc981, NULL, 0);
+   sesc_spawn(threadFunc982, NULL, 0);
+   sesc_spawn(threadFunc983, NULL, 0);
+   sesc_spawn(threadFunc984, NULL, 0);
+   sesc_spawn(threadFunc985, NULL, 0);
+   sesc_spawn(threadFunc986, NULL, 0);
+   sesc_spawn(threadFunc987, NULL, 0);
+   sesc_spawn(threadFunc988, NULL, 0);
+   sesc_spawn(threadFunc989, NULL, 0);
+   sesc_spawn(threadFunc990, NULL, 0);
+   sesc_spawn(threadFunc991, NULL, 0);
+   sesc_spawn(threadFunc992, NULL, 0);
+   sesc_spawn(threadFunc993, NULL, 0);
+   sesc_spawn(threadFunc994, NULL, 0);
+   sesc_spawn(threadFunc995, NULL, 0);
+   sesc_spawn(threadFunc996, NULL, 0);
+   sesc_spawn(threadFunc997, NULL, 0);
+   sesc_spawn(threadFunc998, NULL, 0);
+   sesc_spawn(threadFunc999, NULL, 0);
+   sesc_spawn(threadFunc1000, NULL, 0);
+   sesc_spawn(threadFunc1001, NULL, 0);
+   sesc_spawn(threadFunc1002, NULL, 0);
+   sesc_spawn(threadFunc1003, NULL, 0);
+   sesc_spawn(threadFunc1004, NULL, 0);
+   sesc_spawn(threadFunc1005, NULL, 0);
+   sesc_spawn(threadFunc1006, NULL, 0);
+   sesc_spawn(threadFunc1007, NULL, 0);
+   sesc_spawn(threadFunc1008, NULL, 0);
+   sesc_spawn(threadFunc1009, NULL, 0);
+   sesc_spawn(threadFunc1010, NULL, 0);
+   sesc_spawn(threadFunc1011, NULL, 0);
+   sesc_spawn(threadFunc1012, NULL, 0);
+   sesc_spawn(threadFunc1013, NULL, 0);
+   sesc_spawn(threadFunc1014, NULL, 0);
+   sesc_spawn(threadFunc1015, NULL, 0);
+   sesc_spawn(threadFunc1016, NULL, 0);
+   sesc_spawn(threadFunc1017, NULL, 0);
+   sesc_spawn(threadFunc1018, NULL, 0);
+   sesc_spawn(threadFunc1019, NULL, 0);
+   sesc_spawn(threadFunc1020, NULL, 0);
+   sesc_spawn(threadFunc1021, NULL, 0);
+   sesc_spawn(threadFunc1022, NULL, 0);
+   sesc_spawn(threadFunc1023, NULL, 0);
+
+   for(counter = 0; counter < LOOP_0; counter++)
+   {
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_0_0_:");
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f10), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s0) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s2) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t4) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f2) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f2) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s0) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s1) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s3) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s0) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s1) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 2"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_0_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "b I0_1_  "	 : : );
+
+   __asm__ __volatile__ ("I0_1_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ("LOOP_START_0_1_:");
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f10), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f8) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s1) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f10), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 224(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 2"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_1_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s0) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f8) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I0_2_  "	 : : );
+
+   __asm__ __volatile__ ("I0_2_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_0_2_:");
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f10), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f4) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f4) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f6) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s0) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 2"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_2_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "b I0_3_  "	 : : );
+
+   __asm__ __volatile__ ("I0_3_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ("LOOP_START_0_3_:");
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f2) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 544(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "sw %1, 608(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 640(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "sw %1, 224(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f8) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 672(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t4) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "sw %1, 256(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 704(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 288(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 2"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_3_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f8) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "sw %1, 480(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I0_4_  "	 : : );
+
+   __asm__ __volatile__ ("I0_4_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_0_4_:");
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f6) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s1) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f8) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f8) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 2"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_4_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "b I0_5_  "	 : : );
+
+   __asm__ __volatile__ ("I0_5_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ("LOOP_START_0_5_:");
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s0) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f4) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f2) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 224(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t2) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "sw %1, 256(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "sw %1, 768(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 288(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 640(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 672(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 704(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 320(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 352(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "sw %1, 384(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f2) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 736(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s2) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 768(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 800(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 736(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 832(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 864(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 416(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 896(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 928(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f4) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "sw %1, 448(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 2"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_5_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s1) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 704(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 704(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 832(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 800(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 896(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s0) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 864(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 864(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 736(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 832(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 640(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 768(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I0_6_  "	 : : );
+
+   __asm__ __volatile__ ("I0_6_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_0_6_:");
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f10), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f10), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f4) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s0) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f6) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 2"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_6_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "b I0_7_  "	 : : );
+
+   __asm__ __volatile__ ("I0_7_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ( "lw %0, 800(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ("LOOP_START_0_7_:");
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s0) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "sw %1, 832(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 864(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f6) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "sw %1, 896(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s0) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 928(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 960(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 992(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 1024(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 1056(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s1) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t2) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 1088(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f8) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 1120(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s1) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "sw %1, 1152(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 1184(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 1216(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 1248(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 1280(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f4) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 1312(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 1344(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 1376(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 1408(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 1440(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 1472(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 1504(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 1536(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s0) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 1568(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s0) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 1600(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 1632(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f8) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 1664(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 1696(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 1728(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 1760(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t4) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s1) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 1792(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 1824(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 1856(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "sw %1, 1888(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 1920(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 1952(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 1984(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 2016(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 2"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_7_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f8) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f4) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f6) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f4) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s3) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s1) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 800(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I0_8_  "	 : : );
+
+   __asm__ __volatile__ ("I0_8_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_0_8_:");
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s0) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s0) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s3) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t2) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f2) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s1) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f10), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f2) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f2) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 2"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_8_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "b I0_9_  "	 : : );
+
+   __asm__ __volatile__ ("I0_9_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ("LOOP_START_0_9_:");
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s2) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 2016(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 2048(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f6) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 2080(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 2080(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f6) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 2112(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s0) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f4) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "sw %1, 224(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 2144(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "sw %1, 2112(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 256(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 2"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_9_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f10), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I0_10_  "	 : : );
+
+   __asm__ __volatile__ ("I0_10_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_0_10_:");
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f10), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t3) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t2) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t2) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s1) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f8) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f2) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 2"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_10_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "b I0_11_  "	 : : );
+
+   __asm__ __volatile__ ("I0_11_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ( "lw %0, 2176(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ("LOOP_START_0_11_:");
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f4) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s1) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s3) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s0) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 640(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 672(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 224(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 256(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 704(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 736(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 288(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 320(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f4) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 768(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 352(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 2"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_11_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 736(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 704(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 768(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f2) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s0) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 640(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 736(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s0) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 704(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s1) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f2) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 2176(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I0_12_  "	 : : );
+
+   __asm__ __volatile__ ("I0_12_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_0_12_:");
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f6) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t3) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f10), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f8) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f4) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s2) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 2"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_12_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f6) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "b I0_13_  "	 : : );
+
+   __asm__ __volatile__ ("I0_13_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ("LOOP_START_0_13_:");
+   __asm__ __volatile__ ( "lw %0, 2208(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 2240(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 2272(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 2304(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "sw %1, 2240(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 2336(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 2368(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 2400(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 2432(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "sw %1, 2272(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 2304(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 2336(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 2464(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 2368(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 2400(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 2496(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 2528(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 2432(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 2464(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "sw %1, 2496(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 2560(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 2592(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "sw %1, 2528(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s1) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 2624(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s3) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 2656(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 2688(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 2720(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f2) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 2752(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f8) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 2560(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 2784(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 2816(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 2848(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 2880(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 2912(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f4) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 2592(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 2"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_13_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f4) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f10), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f2) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_s2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I0_14_  "	 : : );
+
+   __asm__ __volatile__ ("I0_14_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   __asm__ __volatile__ ("LOOP_START_0_14_:");
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t2) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f10), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t3) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s2) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f10), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f2) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f10), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 2"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_14_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f8) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "b I0_15_  "	 : : );
+
+   __asm__ __volatile__ ("I0_15_:");
+   __asm__ __volatile__ ( "move %0, $0"          : "=r"(cell_counter) );
+   BEGIN_TRANSACTION(0);
+   __asm__ __volatile__ ( "lw %0, 2944(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ("LOOP_START_0_15_:");
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s3) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f4) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 160(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 192(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 0(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "sw %1, 2976(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 32(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f6) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 64(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f4) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 352(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 384(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 96(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "sw %1, 3008(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t2) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 3040(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 3072(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f2) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t2) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "sw %1, 128(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s2) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "sw %1, 160(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s1) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "lw %0, 3104(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 3136(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s2) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "sw %1, 192(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 3168(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f4) , "f"(r_out_f4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f10), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 3200(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s0) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 544(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 576(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 3232(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 224(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 256(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f10), "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f8) , "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f2) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 3264(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 640(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 672(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s0) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s0)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t2) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 704(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 704(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 736(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s0) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_s0) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_s3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 288(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f8) , "f"(r_out_f2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s1) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "sw %1, 320(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 768(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "sw %1, 352(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "lw %0, 800(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f6) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t5) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 3296(%1)  "	 : "=r"(r_out_s0)  : "r"(s_data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "lw %0, 832(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 384(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f2) , "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s1) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "sw %1, 416(%0)  "	 : "=r"(data_out_int) : "r"(r_out_s0)  : "memory" );
+   __asm__ __volatile__ ( "addi %0, %1, 1"       : "=r"(cell_counter) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "slti %0, %1, 2"       : "=r"(r_out_t0) :"r"(cell_counter) );
+   __asm__ __volatile__ ( "bne  %0, $0, LOOP_START_0_15_" : :"r"(r_out_t0) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f6)  : "f"(r_out_f10), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 512(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f12), "f"(r_out_f8)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 32(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f4)  : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_t4) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t3)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 800(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_s0)  );
+   __asm__ __volatile__ ( "lw %0, 480(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s1)  : "r"(r_out_t4) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t4) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s2)  : "r"(r_out_s3) , "r"(r_out_t4)  );
+   __asm__ __volatile__ ( "lw %0, 224(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f10) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_s3)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s0) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 320(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 288(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 448(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 640(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f2) , "f"(r_out_f6)  );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_s3)  : "r"(r_out_t4) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 704(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 672(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 0(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 416(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t5) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_s0) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 64(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t5) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f2)  : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t2)  : "r"(r_out_s1) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f12), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 768(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f12) : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t2) , "r"(r_out_s2)  );
+   __asm__ __volatile__ ( "lw %0, 256(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 640(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f8)  : "f"(r_out_f8) , "f"(r_out_f12) );
+   __asm__ __volatile__ ( "lw %0, 640(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t5)  );
+   __asm__ __volatile__ ( "lw %0, 768(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_s1)  );
+   __asm__ __volatile__ ( "lw %0, 608(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "lw %0, 96(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_s0) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "add.d %0, %1, %2  "	 : "=f"(r_out_f10) : "f"(r_out_f10), "f"(r_out_f12) );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t4)  : "r"(r_out_t4) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "xor %0, %1, %2  "	 : "=r"(r_out_t5)  : "r"(r_out_t3) , "r"(r_out_t2)  );
+   __asm__ __volatile__ ( "lw %0, 128(%1)  "	 : "=r"(r_out_s0)  : "r"(data_out_int) );
+   __asm__ __volatile__ ( "sw %1, 2944(%0)  "	 : "=r"(s_data_out_int) : "r"(r_out_s0)  : "memory" );
+   COMMIT_TRANSACTION(0);
+   __asm__ __volatile__ ( "b I0_16_  "	 : : );
+
+   __asm__ __volatile__ ("I0_16_:");
+   }	//end LOOP
+
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+   sesc_wait();
+
+
+   return 0;
+}